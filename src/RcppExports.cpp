@@ -6,12 +6,12 @@
 using namespace Rcpp;
 
 // cpp_dbern
-NumericVector cpp_dbern(const NumericVector& x, const NumericVector& prob, const bool& log_prob);
+NumericVector cpp_dbern(SEXP x, const NumericVector& prob, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_dbern(SEXP xSEXP, SEXP probSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type prob(probSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
     rcpp_result_gen = Rcpp::wrap(cpp_dbern(x, prob, log_prob));
@@ -19,12 +19,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_pbern
-NumericVector cpp_pbern(const NumericVector& x, const NumericVector& prob, const bool& lower_tail, const bool& log_prob);
+NumericVector cpp_pbern(SEXP x, const NumericVector& prob, const bool& lower_tail, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_pbern(SEXP xSEXP, SEXP probSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type prob(probSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
@@ -47,7 +47,7 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_rbern
-NumericVector cpp_rbern(const int& n, const NumericVector& prob);
+SEXP cpp_rbern(const int& n, const NumericVector& prob);
 RcppExport SEXP extraDistr_cpp_rbern(SEXP nSEXP, SEXP probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -59,12 +59,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_dbbinom
-NumericVector cpp_dbbinom(const NumericVector& x, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta, const bool& log_prob);
+NumericVector cpp_dbbinom(SEXP x, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_dbbinom(SEXP xSEXP, SEXP sizeSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
@@ -74,12 +74,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_pbbinom
-NumericVector cpp_pbbinom(const NumericVector& x, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
+NumericVector cpp_pbbinom(SEXP x, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_pbbinom(SEXP xSEXP, SEXP sizeSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
@@ -89,8 +89,24 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_qbbinom
+NumericVector cpp_qbbinom(const NumericVector& p, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_qbbinom(SEXP pSEXP, SEXP sizeSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qbbinom(p, size, alpha, beta, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_rbbinom
-NumericVector cpp_rbbinom(const int& n, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta);
+SEXP cpp_rbbinom(const int& n, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta);
 RcppExport SEXP extraDistr_cpp_rbbinom(SEXP nSEXP, SEXP sizeSEXP, SEXP alphaSEXP, SEXP betaSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -104,12 +120,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_dbnbinom
-NumericVector cpp_dbnbinom(const NumericVector& x, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta, const bool& log_prob);
+NumericVector cpp_dbnbinom(SEXP x, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_dbnbinom(SEXP xSEXP, SEXP sizeSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
@@ -119,12 +135,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_pbnbinom
-NumericVector cpp_pbnbinom(const NumericVector& x, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
+NumericVector cpp_pbnbinom(SEXP x, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_pbnbinom(SEXP xSEXP, SEXP sizeSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
@@ -134,8 +150,24 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_qbnbinom
+NumericVector cpp_qbnbinom(const NumericVector& p, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_qbnbinom(SEXP pSEXP, SEXP sizeSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qbnbinom(p, size, alpha, beta, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_rbnbinom
-NumericVector cpp_rbnbinom(const int& n, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta);
+SEXP cpp_rbnbinom(const int& n, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta);
 RcppExport SEXP extraDistr_cpp_rbnbinom(SEXP nSEXP, SEXP sizeSEXP, SEXP alphaSEXP, SEXP betaSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -240,6 +272,22 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_qbhatt
+NumericVector cpp_qbhatt(const NumericVector& p, const NumericVector& mu, const NumericVector& sigma, const NumericVector& a, const bool& lower_tail, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_qbhatt(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP aSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qbhatt(p, mu, sigma, a, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_rbhatt
 NumericVector cpp_rbhatt(const int& n, const NumericVector& mu, const NumericVector& sigma, const NumericVector& a);
 RcppExport SEXP extraDistr_cpp_rbhatt(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP aSEXP) {
@@ -333,6 +381,27 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_pbnorm
+NumericVector cpp_pbnorm(const NumericVector& x, const NumericVector& y, const NumericVector& lower_x, const NumericVector& lower_y, const NumericVector& mu1, const NumericVector& mu2, const NumericVector& sigma1, const NumericVector& sigma2, const NumericVector& rho, const bool& lower_tail, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_pbnorm(SEXP xSEXP, SEXP ySEXP, SEXP lower_xSEXP, SEXP lower_ySEXP, SEXP mu1SEXP, SEXP mu2SEXP, SEXP sigma1SEXP, SEXP sigma2SEXP, SEXP rhoSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lower_x(lower_xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lower_y(lower_ySEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu1(mu1SEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu2(mu2SEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma1(sigma1SEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma2(sigma2SEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type rho(rhoSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pbnorm(x, y, lower_x, lower_y, mu1, mu2, sigma1, sigma2, rho, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_rbnorm
 NumericMatrix cpp_rbnorm(const int& n, const NumericVector& mu1, const NumericVector& mu2, const NumericVector& sigma1, const NumericVector& sigma2, const NumericVector& rho);
 RcppExport SEXP extraDistr_cpp_rbnorm(SEXP nSEXP, SEXP mu1SEXP, SEXP mu2SEXP, SEXP sigma1SEXP, SEXP sigma2SEXP, SEXP rhoSEXP) {
@@ -365,8 +434,41 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_dbpois_grid
+NumericVector cpp_dbpois_grid(const NumericVector& x, const NumericVector& y, const NumericVector& a, const NumericVector& b, const NumericVector& c, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_dbpois_grid(SEXP xSEXP, SEXP ySEXP, SEXP aSEXP, SEXP bSEXP, SEXP cSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type c(cSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dbpois_grid(x, y, a, b, c, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_pbpois
+NumericVector cpp_pbpois(const NumericVector& x, const NumericVector& y, const NumericVector& a, const NumericVector& b, const NumericVector& c, const bool& lower_tail, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_pbpois(SEXP xSEXP, SEXP ySEXP, SEXP aSEXP, SEXP bSEXP, SEXP cSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type c(cSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pbpois(x, y, a, b, c, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_rbpois
-NumericMatrix cpp_rbpois(const int& n, const NumericVector& a, const NumericVector& b, const NumericVector& c);
+SEXP cpp_rbpois(const int& n, const NumericVector& a, const NumericVector& b, const NumericVector& c);
 RcppExport SEXP extraDistr_cpp_rbpois(SEXP nSEXP, SEXP aSEXP, SEXP bSEXP, SEXP cSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -380,12 +482,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_dcat
-NumericVector cpp_dcat(const NumericVector& x, const NumericMatrix& prob, const bool& log_prob);
+NumericVector cpp_dcat(SEXP x, const NumericMatrix& prob, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_dcat(SEXP xSEXP, SEXP probSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericMatrix& >::type prob(probSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
     rcpp_result_gen = Rcpp::wrap(cpp_dcat(x, prob, log_prob));
@@ -393,12 +495,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_pcat
-NumericVector cpp_pcat(const NumericVector& x, const NumericMatrix& prob, bool lower_tail, bool log_prob);
+NumericVector cpp_pcat(SEXP x, const NumericMatrix& prob, bool lower_tail, bool log_prob);
 RcppExport SEXP extraDistr_cpp_pcat(SEXP xSEXP, SEXP probSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericMatrix& >::type prob(probSEXP);
     Rcpp::traits::input_parameter< bool >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< bool >::type log_prob(log_probSEXP);
@@ -421,14 +523,42 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_rcat
-NumericVector cpp_rcat(const int& n, const NumericMatrix& prob);
-RcppExport SEXP extraDistr_cpp_rcat(SEXP nSEXP, SEXP probSEXP) {
+Rcpp::IntegerVector cpp_rcat(const int& n, const NumericMatrix& prob, SEXP out);
+RcppExport SEXP extraDistr_cpp_rcat(SEXP nSEXP, SEXP probSEXP, SEXP outSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
     Rcpp::traits::input_parameter< const NumericMatrix& >::type prob(probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rcat(n, prob));
+    Rcpp::traits::input_parameter< SEXP >::type out(outSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rcat(n, prob, out));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_rcat_fill
+Rcpp::IntegerVector cpp_rcat_fill(const Rcpp::IntegerVector& x, SEXP out);
+RcppExport SEXP extraDistr_cpp_rcat_fill(SEXP xSEXP, SEXP outSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::IntegerVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type out(outSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rcat_fill(x, out));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_dcens
+NumericVector cpp_dcens(const NumericVector& x, const NumericVector& status, const std::string& family, const Rcpp::List& params, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_dcens(SEXP xSEXP, SEXP statusSEXP, SEXP familySEXP, SEXP paramsSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type status(statusSEXP);
+    Rcpp::traits::input_parameter< const std::string& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dcens(x, status, family, params, log_prob));
     return rcpp_result_gen;
 END_RCPP
 }
@@ -446,14 +576,15 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_rdirichlet
-NumericMatrix cpp_rdirichlet(const int& n, const NumericMatrix& alpha);
-RcppExport SEXP extraDistr_cpp_rdirichlet(SEXP nSEXP, SEXP alphaSEXP) {
+NumericMatrix cpp_rdirichlet(const int& n, const NumericMatrix& alpha, SEXP out);
+RcppExport SEXP extraDistr_cpp_rdirichlet(SEXP nSEXP, SEXP alphaSEXP, SEXP outSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
     Rcpp::traits::input_parameter< const NumericMatrix& >::type alpha(alphaSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rdirichlet(n, alpha));
+    Rcpp::traits::input_parameter< SEXP >::type out(outSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rdirichlet(n, alpha, out));
     return rcpp_result_gen;
 END_RCPP
 }
@@ -472,7 +603,7 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_rdirmnom
-NumericMatrix cpp_rdirmnom(const int& n, const NumericVector& size, const NumericMatrix& alpha);
+SEXP cpp_rdirmnom(const int& n, const NumericVector& size, const NumericMatrix& alpha);
 RcppExport SEXP extraDistr_cpp_rdirmnom(SEXP nSEXP, SEXP sizeSEXP, SEXP alphaSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -485,12 +616,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_ddgamma
-NumericVector cpp_ddgamma(const NumericVector& x, const NumericVector& shape, const NumericVector& scale, const bool& log_prob);
+NumericVector cpp_ddgamma(SEXP x, const NumericVector& shape, const NumericVector& scale, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_ddgamma(SEXP xSEXP, SEXP shapeSEXP, SEXP scaleSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type shape(shapeSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type scale(scaleSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
@@ -498,13 +629,56 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_pdgamma
+NumericVector cpp_pdgamma(SEXP x, const NumericVector& shape, const NumericVector& scale, const bool& lower_tail, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_pdgamma(SEXP xSEXP, SEXP shapeSEXP, SEXP scaleSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type shape(shapeSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type scale(scaleSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pdgamma(x, shape, scale, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_qdgamma
+NumericVector cpp_qdgamma(const NumericVector& p, const NumericVector& shape, const NumericVector& scale, const bool& lower_tail, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_qdgamma(SEXP pSEXP, SEXP shapeSEXP, SEXP scaleSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type shape(shapeSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type scale(scaleSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qdgamma(p, shape, scale, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_rdgamma
+SEXP cpp_rdgamma(const int& n, const NumericVector& shape, const NumericVector& scale);
+RcppExport SEXP extraDistr_cpp_rdgamma(SEXP nSEXP, SEXP shapeSEXP, SEXP scaleSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type shape(shapeSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type scale(scaleSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rdgamma(n, shape, scale));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_ddlaplace
-NumericVector cpp_ddlaplace(const NumericVector& x, const NumericVector& location, const NumericVector& scale, const bool& log_prob);
+NumericVector cpp_ddlaplace(SEXP x, const NumericVector& location, const NumericVector& scale, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_ddlaplace(SEXP xSEXP, SEXP locationSEXP, SEXP scaleSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type location(locationSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type scale(scaleSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
@@ -513,12 +687,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_pdlaplace
-NumericVector cpp_pdlaplace(const NumericVector& x, const NumericVector& location, const NumericVector& scale, const bool& lower_tail, const bool& log_prob);
+NumericVector cpp_pdlaplace(SEXP x, const NumericVector& location, const NumericVector& scale, const bool& lower_tail, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_pdlaplace(SEXP xSEXP, SEXP locationSEXP, SEXP scaleSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type location(locationSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type scale(scaleSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
@@ -528,7 +702,7 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_rdlaplace
-NumericVector cpp_rdlaplace(const int& n, const NumericVector& location, const NumericVector& scale);
+SEXP cpp_rdlaplace(const int& n, const NumericVector& location, const NumericVector& scale);
 RcppExport SEXP extraDistr_cpp_rdlaplace(SEXP nSEXP, SEXP locationSEXP, SEXP scaleSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -541,12 +715,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_ddnorm
-NumericVector cpp_ddnorm(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const bool& log_prob);
+NumericVector cpp_ddnorm(SEXP x, const NumericVector& mu, const NumericVector& sigma, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_ddnorm(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
@@ -554,13 +728,56 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_pdnorm
+NumericVector cpp_pdnorm(SEXP x, const NumericVector& mu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_pdnorm(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pdnorm(x, mu, sigma, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_qdnorm
+NumericVector cpp_qdnorm(const NumericVector& p, const NumericVector& mu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_qdnorm(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qdnorm(p, mu, sigma, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_rdnorm
+SEXP cpp_rdnorm(const int& n, const NumericVector& mu, const NumericVector& sigma);
+RcppExport SEXP extraDistr_cpp_rdnorm(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rdnorm(n, mu, sigma));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_ddunif
-NumericVector cpp_ddunif(const NumericVector& x, const NumericVector& min, const NumericVector& max, const bool& log_prob);
+NumericVector cpp_ddunif(SEXP x, const NumericVector& min, const NumericVector& max, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_ddunif(SEXP xSEXP, SEXP minSEXP, SEXP maxSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type min(minSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type max(maxSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
@@ -569,12 +786,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_pdunif
-NumericVector cpp_pdunif(const NumericVector& x, const NumericVector& min, const NumericVector& max, const bool& lower_tail, const bool& log_prob);
+NumericVector cpp_pdunif(SEXP x, const NumericVector& min, const NumericVector& max, const bool& lower_tail, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_pdunif(SEXP xSEXP, SEXP minSEXP, SEXP maxSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type min(minSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type max(maxSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
@@ -599,7 +816,7 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_rdunif
-NumericVector cpp_rdunif(const int& n, const NumericVector& min, const NumericVector& max);
+SEXP cpp_rdunif(const int& n, const NumericVector& min, const NumericVector& max);
 RcppExport SEXP extraDistr_cpp_rdunif(SEXP nSEXP, SEXP minSEXP, SEXP maxSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -612,12 +829,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_ddweibull
-NumericVector cpp_ddweibull(const NumericVector& x, const NumericVector& q, const NumericVector& beta, const bool& log_prob);
+NumericVector cpp_ddweibull(SEXP x, const NumericVector& q, const NumericVector& beta, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_ddweibull(SEXP xSEXP, SEXP qSEXP, SEXP betaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type q(qSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
@@ -626,12 +843,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_pdweibull
-NumericVector cpp_pdweibull(const NumericVector& x, const NumericVector& q, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
+NumericVector cpp_pdweibull(SEXP x, const NumericVector& q, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_pdweibull(SEXP xSEXP, SEXP qSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type q(qSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
@@ -656,7 +873,7 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_rdweibull
-NumericVector cpp_rdweibull(const int& n, const NumericVector& q, const NumericVector& beta);
+SEXP cpp_rdweibull(const int& n, const NumericVector& q, const NumericVector& beta);
 RcppExport SEXP extraDistr_cpp_rdweibull(SEXP nSEXP, SEXP qSEXP, SEXP betaSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -730,12 +947,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_dgpois
-NumericVector cpp_dgpois(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const bool& log_prob);
+NumericVector cpp_dgpois(SEXP x, const NumericVector& alpha, const NumericVector& beta, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_dgpois(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
@@ -744,12 +961,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_pgpois
-NumericVector cpp_pgpois(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
+NumericVector cpp_pgpois(SEXP x, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_pgpois(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
@@ -758,8 +975,23 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_qgpois
+NumericVector cpp_qgpois(const NumericVector& p, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_qgpois(SEXP pSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qgpois(p, alpha, beta, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_rgpois
-NumericVector cpp_rgpois(const int& n, const NumericVector& alpha, const NumericVector& beta);
+SEXP cpp_rgpois(const int& n, const NumericVector& alpha, const NumericVector& beta);
 RcppExport SEXP extraDistr_cpp_rgpois(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -1231,6 +1463,31 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_instrument_clock
+double cpp_instrument_clock();
+RcppExport SEXP extraDistr_cpp_instrument_clock() {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    rcpp_result_gen = Rcpp::wrap(cpp_instrument_clock());
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_pinterval
+NumericVector cpp_pinterval(const NumericVector& lo, const NumericVector& hi, const std::string& family, const Rcpp::List& params, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_pinterval(SEXP loSEXP, SEXP hiSEXP, SEXP familySEXP, SEXP paramsSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type lo(loSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type hi(hiSEXP);
+    Rcpp::traits::input_parameter< const std::string& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pinterval(lo, hi, family, params, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_dinvgamma
 NumericVector cpp_dinvgamma(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_dinvgamma(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP log_probSEXP) {
@@ -1359,13 +1616,41 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_rlazy
+SEXP cpp_rlazy(const double& n, const std::string& family, const Rcpp::List& params, const NumericVector& seed);
+RcppExport SEXP extraDistr_cpp_rlazy(SEXP nSEXP, SEXP familySEXP, SEXP paramsSEXP, SEXP seedSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const double& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const std::string& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type seed(seedSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rlazy(n, family, params, seed));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_llfamily
+double cpp_llfamily(const NumericVector& x, const std::string& family, const Rcpp::List& params, const NumericVector& weights);
+RcppExport SEXP extraDistr_cpp_llfamily(SEXP xSEXP, SEXP familySEXP, SEXP paramsSEXP, SEXP weightsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const std::string& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type weights(weightsSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_llfamily(x, family, params, weights));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_dlgser
-NumericVector cpp_dlgser(const NumericVector& x, const NumericVector& theta, const bool& log_prob);
+NumericVector cpp_dlgser(SEXP x, const NumericVector& theta, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_dlgser(SEXP xSEXP, SEXP thetaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type theta(thetaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
     rcpp_result_gen = Rcpp::wrap(cpp_dlgser(x, theta, log_prob));
@@ -1373,12 +1658,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_plgser
-NumericVector cpp_plgser(const NumericVector& x, const NumericVector& theta, const bool& lower_tail, const bool& log_prob);
+NumericVector cpp_plgser(SEXP x, const NumericVector& theta, const bool& lower_tail, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_plgser(SEXP xSEXP, SEXP thetaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type theta(thetaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
@@ -1401,7 +1686,7 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_rlgser
-NumericVector cpp_rlgser(const int& n, const NumericVector& theta);
+SEXP cpp_rlgser(const int& n, const NumericVector& theta);
 RcppExport SEXP extraDistr_cpp_rlgser(SEXP nSEXP, SEXP thetaSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -1469,9 +1754,71 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_dmix
+NumericVector cpp_dmix(const NumericVector& x, const std::string& family, const Rcpp::List& params, const NumericMatrix& alpha, const bool& log_prob, const bool& responsibilities);
+RcppExport SEXP extraDistr_cpp_dmix(SEXP xSEXP, SEXP familySEXP, SEXP paramsSEXP, SEXP alphaSEXP, SEXP log_probSEXP, SEXP responsibilitiesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const std::string& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type responsibilities(responsibilitiesSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dmix(x, family, params, alpha, log_prob, responsibilities));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_pmix
+NumericVector cpp_pmix(const NumericVector& x, const std::string& family, const Rcpp::List& params, const NumericMatrix& alpha, const bool& lower_tail, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_pmix(SEXP xSEXP, SEXP familySEXP, SEXP paramsSEXP, SEXP alphaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const std::string& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pmix(x, family, params, alpha, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_qmix
+NumericVector cpp_qmix(const NumericVector& p, const std::string& family, const Rcpp::List& params, const NumericMatrix& alpha, const bool& lower_tail, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_qmix(SEXP pSEXP, SEXP familySEXP, SEXP paramsSEXP, SEXP alphaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const std::string& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qmix(p, family, params, alpha, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_rmix
+NumericVector cpp_rmix(const int& n, const std::string& family, const Rcpp::List& params, const NumericMatrix& alpha);
+RcppExport SEXP extraDistr_cpp_rmix(SEXP nSEXP, SEXP familySEXP, SEXP paramsSEXP, SEXP alphaSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const std::string& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type alpha(alphaSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rmix(n, family, params, alpha));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_dmixnorm
-NumericVector cpp_dmixnorm(const NumericVector& x, const NumericMatrix& mu, const NumericMatrix& sigma, const NumericMatrix& alpha, const bool& log_prob);
-RcppExport SEXP extraDistr_cpp_dmixnorm(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP alphaSEXP, SEXP log_probSEXP) {
+NumericVector cpp_dmixnorm(const NumericVector& x, const NumericMatrix& mu, const NumericMatrix& sigma, const NumericMatrix& alpha, const bool& log_prob, const bool& responsibilities);
+RcppExport SEXP extraDistr_cpp_dmixnorm(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP alphaSEXP, SEXP log_probSEXP, SEXP responsibilitiesSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
@@ -1480,7 +1827,8 @@ BEGIN_RCPP
     Rcpp::traits::input_parameter< const NumericMatrix& >::type sigma(sigmaSEXP);
     Rcpp::traits::input_parameter< const NumericMatrix& >::type alpha(alphaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dmixnorm(x, mu, sigma, alpha, log_prob));
+    Rcpp::traits::input_parameter< const bool& >::type responsibilities(responsibilitiesSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dmixnorm(x, mu, sigma, alpha, log_prob, responsibilities));
     return rcpp_result_gen;
 END_RCPP
 }
@@ -1500,6 +1848,22 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_qmixnorm
+NumericVector cpp_qmixnorm(const NumericVector& p, const NumericMatrix& mu, const NumericMatrix& sigma, const NumericMatrix& alpha, const bool& lower_tail, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_qmixnorm(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP alphaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qmixnorm(p, mu, sigma, alpha, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_rmixnorm
 NumericVector cpp_rmixnorm(const int& n, const NumericMatrix& mu, const NumericMatrix& sigma, const NumericMatrix& alpha);
 RcppExport SEXP extraDistr_cpp_rmixnorm(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP alphaSEXP) {
@@ -1515,26 +1879,27 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_dmixpois
-NumericVector cpp_dmixpois(const NumericVector& x, const NumericMatrix& lambda, const NumericMatrix& alpha, const bool& log_prob);
-RcppExport SEXP extraDistr_cpp_dmixpois(SEXP xSEXP, SEXP lambdaSEXP, SEXP alphaSEXP, SEXP log_probSEXP) {
+NumericVector cpp_dmixpois(SEXP x, const NumericMatrix& lambda, const NumericMatrix& alpha, const bool& log_prob, const bool& responsibilities);
+RcppExport SEXP extraDistr_cpp_dmixpois(SEXP xSEXP, SEXP lambdaSEXP, SEXP alphaSEXP, SEXP log_probSEXP, SEXP responsibilitiesSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericMatrix& >::type lambda(lambdaSEXP);
     Rcpp::traits::input_parameter< const NumericMatrix& >::type alpha(alphaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dmixpois(x, lambda, alpha, log_prob));
+    Rcpp::traits::input_parameter< const bool& >::type responsibilities(responsibilitiesSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dmixpois(x, lambda, alpha, log_prob, responsibilities));
     return rcpp_result_gen;
 END_RCPP
 }
 // cpp_pmixpois
-NumericVector cpp_pmixpois(const NumericVector& x, const NumericMatrix& lambda, const NumericMatrix& alpha, const bool& lower_tail, const bool& log_prob);
+NumericVector cpp_pmixpois(SEXP x, const NumericMatrix& lambda, const NumericMatrix& alpha, const bool& lower_tail, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_pmixpois(SEXP xSEXP, SEXP lambdaSEXP, SEXP alphaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericMatrix& >::type lambda(lambdaSEXP);
     Rcpp::traits::input_parameter< const NumericMatrix& >::type alpha(alphaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
@@ -1544,7 +1909,7 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_rmixpois
-NumericVector cpp_rmixpois(const int& n, const NumericMatrix& lambda, const NumericMatrix& alpha);
+SEXP cpp_rmixpois(const int& n, const NumericMatrix& lambda, const NumericMatrix& alpha);
 RcppExport SEXP extraDistr_cpp_rmixpois(SEXP nSEXP, SEXP lambdaSEXP, SEXP alphaSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -1571,7 +1936,7 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_rmnom
-NumericMatrix cpp_rmnom(const int& n, const NumericVector& size, const NumericMatrix& prob);
+SEXP cpp_rmnom(const int& n, const NumericVector& size, const NumericMatrix& prob);
 RcppExport SEXP extraDistr_cpp_rmnom(SEXP nSEXP, SEXP sizeSEXP, SEXP probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -1598,7 +1963,7 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_rmvhyper
-NumericMatrix cpp_rmvhyper(const int& nn, const NumericMatrix& n, const NumericVector& k);
+SEXP cpp_rmvhyper(const int& nn, const NumericMatrix& n, const NumericVector& k);
 RcppExport SEXP extraDistr_cpp_rmvhyper(SEXP nnSEXP, SEXP nSEXP, SEXP kSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -1610,13 +1975,40 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_dmvnorm
+NumericVector cpp_dmvnorm(const NumericMatrix& x, const NumericMatrix& mu, const NumericVector& sigma, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_dmvnorm(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dmvnorm(x, mu, sigma, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_rmvnorm
+NumericMatrix cpp_rmvnorm(const int& n, const NumericMatrix& mu, const NumericVector& sigma);
+RcppExport SEXP extraDistr_cpp_rmvnorm(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rmvnorm(n, mu, sigma));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_dnhyper
-NumericVector cpp_dnhyper(const NumericVector& x, const NumericVector& n, const NumericVector& m, const NumericVector& r, const bool& log_prob);
+NumericVector cpp_dnhyper(SEXP x, const NumericVector& n, const NumericVector& m, const NumericVector& r, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_dnhyper(SEXP xSEXP, SEXP nSEXP, SEXP mSEXP, SEXP rSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type n(nSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type m(mSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type r(rSEXP);
@@ -1626,12 +2018,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_pnhyper
-NumericVector cpp_pnhyper(const NumericVector& x, const NumericVector& n, const NumericVector& m, const NumericVector& r, const bool& lower_tail, const bool& log_prob);
+NumericVector cpp_pnhyper(SEXP x, const NumericVector& n, const NumericVector& m, const NumericVector& r, const bool& lower_tail, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_pnhyper(SEXP xSEXP, SEXP nSEXP, SEXP mSEXP, SEXP rSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type n(nSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type m(mSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type r(rSEXP);
@@ -1658,7 +2050,7 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_rnhyper
-NumericVector cpp_rnhyper(const int& nn, const NumericVector& n, const NumericVector& m, const NumericVector& r);
+SEXP cpp_rnhyper(const int& nn, const NumericVector& n, const NumericVector& m, const NumericVector& r);
 RcppExport SEXP extraDistr_cpp_rnhyper(SEXP nnSEXP, SEXP nSEXP, SEXP mSEXP, SEXP rSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -1969,7 +2361,7 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_rsign
-NumericVector cpp_rsign(const int& n);
+SEXP cpp_rsign(const int& n);
 RcppExport SEXP extraDistr_cpp_rsign(SEXP nSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -2032,6 +2424,54 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_sampler_diag_start
+int cpp_sampler_diag_start();
+RcppExport SEXP extraDistr_cpp_sampler_diag_start() {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    rcpp_result_gen = Rcpp::wrap(cpp_sampler_diag_start());
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_sampler_diag_stop
+Rcpp::DataFrame cpp_sampler_diag_stop(int level);
+RcppExport SEXP extraDistr_cpp_sampler_diag_stop(SEXP levelSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< int >::type level(levelSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_sampler_diag_stop(level));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_score
+NumericVector cpp_score(const NumericVector& x, const std::string& family, const Rcpp::List& params);
+RcppExport SEXP extraDistr_cpp_score(SEXP xSEXP, SEXP familySEXP, SEXP paramsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const std::string& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type params(paramsSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_score(x, family, params));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_llscore
+NumericVector cpp_llscore(const NumericVector& x, const std::string& family, const Rcpp::List& params, const NumericVector& weights);
+RcppExport SEXP extraDistr_cpp_llscore(SEXP xSEXP, SEXP familySEXP, SEXP paramsSEXP, SEXP weightsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const std::string& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type weights(weightsSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_llscore(x, family, params, weights));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_dsgomp
 NumericVector cpp_dsgomp(const NumericVector& x, const NumericVector& b, const NumericVector& eta, bool log_prob);
 RcppExport SEXP extraDistr_cpp_dsgomp(SEXP xSEXP, SEXP bSEXP, SEXP etaSEXP, SEXP log_probSEXP) {
@@ -2061,6 +2501,21 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_qsgomp
+NumericVector cpp_qsgomp(const NumericVector& p, const NumericVector& b, const NumericVector& eta, const bool& lower_tail, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_qsgomp(SEXP pSEXP, SEXP bSEXP, SEXP etaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type eta(etaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qsgomp(p, b, eta, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_rsgomp
 NumericVector cpp_rsgomp(const int& n, const NumericVector& b, const NumericVector& eta);
 RcppExport SEXP extraDistr_cpp_rsgomp(SEXP nSEXP, SEXP bSEXP, SEXP etaSEXP) {
@@ -2075,12 +2530,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_dskellam
-NumericVector cpp_dskellam(const NumericVector& x, const NumericVector& mu1, const NumericVector& mu2, const bool& log_prob);
+NumericVector cpp_dskellam(SEXP x, const NumericVector& mu1, const NumericVector& mu2, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_dskellam(SEXP xSEXP, SEXP mu1SEXP, SEXP mu2SEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type mu1(mu1SEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type mu2(mu2SEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
@@ -2088,8 +2543,38 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_pskellam
+NumericVector cpp_pskellam(SEXP x, const NumericVector& mu1, const NumericVector& mu2, const bool& lower_tail, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_pskellam(SEXP xSEXP, SEXP mu1SEXP, SEXP mu2SEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu1(mu1SEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu2(mu2SEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pskellam(x, mu1, mu2, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_qskellam
+NumericVector cpp_qskellam(const NumericVector& p, const NumericVector& mu1, const NumericVector& mu2, const bool& lower_tail, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_qskellam(SEXP pSEXP, SEXP mu1SEXP, SEXP mu2SEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu1(mu1SEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu2(mu2SEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qskellam(p, mu1, mu2, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_rskellam
-NumericVector cpp_rskellam(const int& n, const NumericVector& mu1, const NumericVector& mu2);
+SEXP cpp_rskellam(const int& n, const NumericVector& mu1, const NumericVector& mu2);
 RcppExport SEXP extraDistr_cpp_rskellam(SEXP nSEXP, SEXP mu1SEXP, SEXP mu2SEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -2130,6 +2615,21 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_qslash
+NumericVector cpp_qslash(const NumericVector& p, const NumericVector& mu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_qslash(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qslash(p, mu, sigma, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_rslash
 NumericVector cpp_rslash(const int& n, const NumericVector& mu, const NumericVector& sigma);
 RcppExport SEXP extraDistr_cpp_rslash(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP) {
@@ -2143,6 +2643,23 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_rstream
+double cpp_rstream(const std::string& file, const double& n, const std::string& family, const Rcpp::List& params, const bool& as_integer, const int& block, const bool& append);
+RcppExport SEXP extraDistr_cpp_rstream(SEXP fileSEXP, SEXP nSEXP, SEXP familySEXP, SEXP paramsSEXP, SEXP as_integerSEXP, SEXP blockSEXP, SEXP appendSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const std::string& >::type file(fileSEXP);
+    Rcpp::traits::input_parameter< const double& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const std::string& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type as_integer(as_integerSEXP);
+    Rcpp::traits::input_parameter< const int& >::type block(blockSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type append(appendSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rstream(file, n, family, params, as_integer, block, append));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_dtriang
 NumericVector cpp_dtriang(const NumericVector& x, const NumericVector& a, const NumericVector& b, const NumericVector& c, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_dtriang(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP cSEXP, SEXP log_probSEXP) {
@@ -2205,12 +2722,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_dtbinom
-NumericVector cpp_dtbinom(const NumericVector& x, const NumericVector& size, const NumericVector& prob, const NumericVector& lower, const NumericVector& upper, const bool& log_prob);
+NumericVector cpp_dtbinom(SEXP x, const NumericVector& size, const NumericVector& prob, const NumericVector& lower, const NumericVector& upper, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_dtbinom(SEXP xSEXP, SEXP sizeSEXP, SEXP probSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type prob(probSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
@@ -2221,12 +2738,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_ptbinom
-NumericVector cpp_ptbinom(const NumericVector& x, const NumericVector& size, const NumericVector& prob, const NumericVector& lower, const NumericVector& upper, const bool& lower_tail, const bool& log_prob);
+NumericVector cpp_ptbinom(SEXP x, const NumericVector& size, const NumericVector& prob, const NumericVector& lower, const NumericVector& upper, const bool& lower_tail, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_ptbinom(SEXP xSEXP, SEXP sizeSEXP, SEXP probSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type prob(probSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
@@ -2255,7 +2772,7 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_rtbinom
-NumericVector cpp_rtbinom(const int& n, const NumericVector& size, const NumericVector& prob, const NumericVector& lower, const NumericVector& upper);
+SEXP cpp_rtbinom(const int& n, const NumericVector& size, const NumericVector& prob, const NumericVector& lower, const NumericVector& upper);
 RcppExport SEXP extraDistr_cpp_rtbinom(SEXP nSEXP, SEXP sizeSEXP, SEXP probSEXP, SEXP lowerSEXP, SEXP upperSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -2269,9 +2786,74 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_dtrunc
+NumericVector cpp_dtrunc(const NumericVector& x, const std::string& family, const Rcpp::List& params, const NumericVector& lower, const NumericVector& upper, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_dtrunc(SEXP xSEXP, SEXP familySEXP, SEXP paramsSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const std::string& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dtrunc(x, family, params, lower, upper, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_ptrunc
+NumericVector cpp_ptrunc(const NumericVector& x, const std::string& family, const Rcpp::List& params, const NumericVector& lower, const NumericVector& upper, const bool& lower_tail, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_ptrunc(SEXP xSEXP, SEXP familySEXP, SEXP paramsSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const std::string& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_ptrunc(x, family, params, lower, upper, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_qtrunc
+NumericVector cpp_qtrunc(const NumericVector& p, const std::string& family, const Rcpp::List& params, const NumericVector& lower, const NumericVector& upper, const bool& lower_tail, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_qtrunc(SEXP pSEXP, SEXP familySEXP, SEXP paramsSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const std::string& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qtrunc(p, family, params, lower, upper, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_rtrunc
+NumericVector cpp_rtrunc(const int& n, const std::string& family, const Rcpp::List& params, const NumericVector& lower, const NumericVector& upper);
+RcppExport SEXP extraDistr_cpp_rtrunc(SEXP nSEXP, SEXP familySEXP, SEXP paramsSEXP, SEXP lowerSEXP, SEXP upperSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const std::string& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rtrunc(n, family, params, lower, upper));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_dtnorm
-NumericVector cpp_dtnorm(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& lower, const NumericVector& upper, const bool& log_prob);
-RcppExport SEXP extraDistr_cpp_dtnorm(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP log_probSEXP) {
+NumericVector cpp_dtnorm(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& lower, const NumericVector& upper, const bool& log_prob, SEXP out);
+RcppExport SEXP extraDistr_cpp_dtnorm(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP log_probSEXP, SEXP outSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
@@ -2281,13 +2863,14 @@ BEGIN_RCPP
     Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dtnorm(x, mu, sigma, lower, upper, log_prob));
+    Rcpp::traits::input_parameter< SEXP >::type out(outSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dtnorm(x, mu, sigma, lower, upper, log_prob, out));
     return rcpp_result_gen;
 END_RCPP
 }
 // cpp_ptnorm
-NumericVector cpp_ptnorm(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& lower, const NumericVector& upper, const bool& lower_tail, const bool& log_prob);
-RcppExport SEXP extraDistr_cpp_ptnorm(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+NumericVector cpp_ptnorm(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& lower, const NumericVector& upper, const bool& lower_tail, const bool& log_prob, SEXP out);
+RcppExport SEXP extraDistr_cpp_ptnorm(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP, SEXP outSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
@@ -2298,13 +2881,14 @@ BEGIN_RCPP
     Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_ptnorm(x, mu, sigma, lower, upper, lower_tail, log_prob));
+    Rcpp::traits::input_parameter< SEXP >::type out(outSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_ptnorm(x, mu, sigma, lower, upper, lower_tail, log_prob, out));
     return rcpp_result_gen;
 END_RCPP
 }
 // cpp_qtnorm
-NumericVector cpp_qtnorm(const NumericVector& p, const NumericVector& mu, const NumericVector& sigma, const NumericVector& lower, const NumericVector& upper, const bool& lower_tail, const bool& log_prob);
-RcppExport SEXP extraDistr_cpp_qtnorm(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+NumericVector cpp_qtnorm(const NumericVector& p, const NumericVector& mu, const NumericVector& sigma, const NumericVector& lower, const NumericVector& upper, const bool& lower_tail, const bool& log_prob, SEXP out);
+RcppExport SEXP extraDistr_cpp_qtnorm(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP, SEXP outSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
@@ -2315,13 +2899,14 @@ BEGIN_RCPP
     Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qtnorm(p, mu, sigma, lower, upper, lower_tail, log_prob));
+    Rcpp::traits::input_parameter< SEXP >::type out(outSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qtnorm(p, mu, sigma, lower, upper, lower_tail, log_prob, out));
     return rcpp_result_gen;
 END_RCPP
 }
 // cpp_rtnorm
-NumericVector cpp_rtnorm(const int& n, const NumericVector& mu, const NumericVector& sigma, const NumericVector& lower, const NumericVector& upper);
-RcppExport SEXP extraDistr_cpp_rtnorm(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lowerSEXP, SEXP upperSEXP) {
+NumericVector cpp_rtnorm(const int& n, const NumericVector& mu, const NumericVector& sigma, const NumericVector& lower, const NumericVector& upper, SEXP out);
+RcppExport SEXP extraDistr_cpp_rtnorm(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP outSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
@@ -2330,17 +2915,18 @@ BEGIN_RCPP
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rtnorm(n, mu, sigma, lower, upper));
+    Rcpp::traits::input_parameter< SEXP >::type out(outSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rtnorm(n, mu, sigma, lower, upper, out));
     return rcpp_result_gen;
 END_RCPP
 }
 // cpp_dtpois
-NumericVector cpp_dtpois(const NumericVector& x, const NumericVector& lambda, const NumericVector& lower, const NumericVector& upper, const bool& log_prob);
+NumericVector cpp_dtpois(SEXP x, const NumericVector& lambda, const NumericVector& lower, const NumericVector& upper, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_dtpois(SEXP xSEXP, SEXP lambdaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
@@ -2350,12 +2936,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_ptpois
-NumericVector cpp_ptpois(const NumericVector& x, const NumericVector& lambda, const NumericVector& lower, const NumericVector& upper, const bool& lower_tail, const bool& log_prob);
+NumericVector cpp_ptpois(SEXP x, const NumericVector& lambda, const NumericVector& lower, const NumericVector& upper, const bool& lower_tail, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_ptpois(SEXP xSEXP, SEXP lambdaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
@@ -2382,7 +2968,7 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_rtpois
-NumericVector cpp_rtpois(const int& n, const NumericVector& lambda, const NumericVector& lower, const NumericVector& upper);
+SEXP cpp_rtpois(const int& n, const NumericVector& lambda, const NumericVector& lower, const NumericVector& upper);
 RcppExport SEXP extraDistr_cpp_rtpois(SEXP nSEXP, SEXP lambdaSEXP, SEXP lowerSEXP, SEXP upperSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -2395,6 +2981,33 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_dtlambda
+NumericVector cpp_dtlambda(const NumericVector& x, const NumericVector& lambda, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_dtlambda(SEXP xSEXP, SEXP lambdaSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dtlambda(x, lambda, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_ptlambda
+NumericVector cpp_ptlambda(const NumericVector& x, const NumericVector& lambda, const bool& lower_tail, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_ptlambda(SEXP xSEXP, SEXP lambdaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_ptlambda(x, lambda, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_qtlambda
 NumericVector cpp_qtlambda(const NumericVector& p, const NumericVector& lambda, const bool& lower_tail, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_qtlambda(SEXP pSEXP, SEXP lambdaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
@@ -2450,6 +3063,21 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_qwald
+NumericVector cpp_qwald(const NumericVector& p, const NumericVector& mu, const NumericVector& lambda, const bool& lower_tail, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_qwald(SEXP pSEXP, SEXP muSEXP, SEXP lambdaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qwald(p, mu, lambda, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_rwald
 NumericVector cpp_rwald(const int& n, const NumericVector& mu, const NumericVector& lambda);
 RcppExport SEXP extraDistr_cpp_rwald(SEXP nSEXP, SEXP muSEXP, SEXP lambdaSEXP) {
@@ -2464,12 +3092,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_dzib
-NumericVector cpp_dzib(const NumericVector& x, const NumericVector& size, const NumericVector& prob, const NumericVector& pi, const bool& log_prob);
+NumericVector cpp_dzib(SEXP x, const NumericVector& size, const NumericVector& prob, const NumericVector& pi, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_dzib(SEXP xSEXP, SEXP sizeSEXP, SEXP probSEXP, SEXP piSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type prob(probSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type pi(piSEXP);
@@ -2479,12 +3107,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_pzib
-NumericVector cpp_pzib(const NumericVector& x, const NumericVector& size, const NumericVector& prob, const NumericVector& pi, const bool& lower_tail, const bool& log_prob);
+NumericVector cpp_pzib(SEXP x, const NumericVector& size, const NumericVector& prob, const NumericVector& pi, const bool& lower_tail, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_pzib(SEXP xSEXP, SEXP sizeSEXP, SEXP probSEXP, SEXP piSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type prob(probSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type pi(piSEXP);
@@ -2511,7 +3139,7 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_rzib
-NumericVector cpp_rzib(const int& n, const NumericVector& size, const NumericVector& prob, const NumericVector& pi);
+SEXP cpp_rzib(const int& n, const NumericVector& size, const NumericVector& prob, const NumericVector& pi);
 RcppExport SEXP extraDistr_cpp_rzib(SEXP nSEXP, SEXP sizeSEXP, SEXP probSEXP, SEXP piSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -2524,13 +3152,93 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_dzi
+NumericVector cpp_dzi(const NumericVector& x, const std::string& family, const Rcpp::List& params, const NumericVector& pi, const bool& hurdle, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_dzi(SEXP xSEXP, SEXP familySEXP, SEXP paramsSEXP, SEXP piSEXP, SEXP hurdleSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const std::string& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type pi(piSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type hurdle(hurdleSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dzi(x, family, params, pi, hurdle, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_pzi
+NumericVector cpp_pzi(const NumericVector& x, const std::string& family, const Rcpp::List& params, const NumericVector& pi, const bool& hurdle, const bool& lower_tail, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_pzi(SEXP xSEXP, SEXP familySEXP, SEXP paramsSEXP, SEXP piSEXP, SEXP hurdleSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const std::string& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type pi(piSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type hurdle(hurdleSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pzi(x, family, params, pi, hurdle, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_qzi
+NumericVector cpp_qzi(const NumericVector& p, const std::string& family, const Rcpp::List& params, const NumericVector& pi, const bool& hurdle, const bool& lower_tail, const bool& log_prob);
+RcppExport SEXP extraDistr_cpp_qzi(SEXP pSEXP, SEXP familySEXP, SEXP paramsSEXP, SEXP piSEXP, SEXP hurdleSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const std::string& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type pi(piSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type hurdle(hurdleSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qzi(p, family, params, pi, hurdle, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_rzi
+NumericVector cpp_rzi(const int& n, const std::string& family, const Rcpp::List& params, const NumericVector& pi, const bool& hurdle);
+RcppExport SEXP extraDistr_cpp_rzi(SEXP nSEXP, SEXP familySEXP, SEXP paramsSEXP, SEXP piSEXP, SEXP hurdleSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const std::string& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type pi(piSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type hurdle(hurdleSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rzi(n, family, params, pi, hurdle));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_llzi
+NumericVector cpp_llzi(const NumericVector& x, const std::string& family, const Rcpp::List& params, const NumericVector& pi, const bool& hurdle);
+RcppExport SEXP extraDistr_cpp_llzi(SEXP xSEXP, SEXP familySEXP, SEXP paramsSEXP, SEXP piSEXP, SEXP hurdleSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const std::string& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type pi(piSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type hurdle(hurdleSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_llzi(x, family, params, pi, hurdle));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_dzinb
-NumericVector cpp_dzinb(const NumericVector& x, const NumericVector& size, const NumericVector& prob, const NumericVector& pi, const bool& log_prob);
+NumericVector cpp_dzinb(SEXP x, const NumericVector& size, const NumericVector& prob, const NumericVector& pi, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_dzinb(SEXP xSEXP, SEXP sizeSEXP, SEXP probSEXP, SEXP piSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type prob(probSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type pi(piSEXP);
@@ -2540,12 +3248,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_pzinb
-NumericVector cpp_pzinb(const NumericVector& x, const NumericVector& size, const NumericVector& prob, const NumericVector& pi, const bool& lower_tail, const bool& log_prob);
+NumericVector cpp_pzinb(SEXP x, const NumericVector& size, const NumericVector& prob, const NumericVector& pi, const bool& lower_tail, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_pzinb(SEXP xSEXP, SEXP sizeSEXP, SEXP probSEXP, SEXP piSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type prob(probSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type pi(piSEXP);
@@ -2572,7 +3280,7 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_rzinb
-NumericVector cpp_rzinb(const int& n, const NumericVector& size, const NumericVector& prob, const NumericVector& pi);
+SEXP cpp_rzinb(const int& n, const NumericVector& size, const NumericVector& prob, const NumericVector& pi);
 RcppExport SEXP extraDistr_cpp_rzinb(SEXP nSEXP, SEXP sizeSEXP, SEXP probSEXP, SEXP piSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -2586,12 +3294,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_dzip
-NumericVector cpp_dzip(const NumericVector& x, const NumericVector& lambda, const NumericVector& pi, const bool& log_prob);
+NumericVector cpp_dzip(SEXP x, const NumericVector& lambda, const NumericVector& pi, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_dzip(SEXP xSEXP, SEXP lambdaSEXP, SEXP piSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type pi(piSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
@@ -2600,12 +3308,12 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_pzip
-NumericVector cpp_pzip(const NumericVector& x, const NumericVector& lambda, const NumericVector& pi, const bool& lower_tail, const bool& log_prob);
+NumericVector cpp_pzip(SEXP x, const NumericVector& lambda, const NumericVector& pi, const bool& lower_tail, const bool& log_prob);
 RcppExport SEXP extraDistr_cpp_pzip(SEXP xSEXP, SEXP lambdaSEXP, SEXP piSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type pi(piSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
@@ -2630,7 +3338,7 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_rzip
-NumericVector cpp_rzip(const int& n, const NumericVector& lambda, const NumericVector& pi);
+SEXP cpp_rzip(const int& n, const NumericVector& lambda, const NumericVector& pi);
 RcppExport SEXP extraDistr_cpp_rzip(SEXP nSEXP, SEXP lambdaSEXP, SEXP piSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
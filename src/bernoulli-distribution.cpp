@@ -79,11 +79,11 @@ inline double rng_bernoulli(double prob, bool& throw_warning) {
 }
 
 
-// [[Rcpp::export]]
-NumericVector cpp_dbern(
-    const NumericVector& x,
+template <typename T>
+inline NumericVector dbern_values(
+    const T& x,
     const NumericVector& prob,
-    const bool& log_prob = false
+    const bool& log_prob
   ) {
   
   int Nmax = std::max({
@@ -95,7 +95,7 @@ NumericVector cpp_dbern(
   bool throw_warning = false;
   
   for (int i = 0; i < Nmax; i++)
-    p[i] = pdf_bernoulli(GETV(x, i), GETV(prob, i),
+    p[i] = pdf_bernoulli(as_dbl(GETV(x, i)), GETV(prob, i),
                          throw_warning);
   
   if (log_prob)
@@ -109,13 +109,26 @@ NumericVector cpp_dbern(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_pbern(
-    const NumericVector& x,
+NumericVector cpp_dbern(
+    SEXP x,
     const NumericVector& prob,
-    const bool& lower_tail = true,
     const bool& log_prob = false
   ) {
   
+  if (TYPEOF(x) == INTSXP)
+    return dbern_values(Rcpp::IntegerVector(x), prob, log_prob);
+  return dbern_values(NumericVector(x), prob, log_prob);
+}
+
+
+template <typename T>
+inline NumericVector pbern_values(
+    const T& x,
+    const NumericVector& prob,
+    const bool& lower_tail,
+    const bool& log_prob
+  ) {
+  
   int Nmax = std::max({
     x.length(),
     prob.length()
@@ -125,7 +138,7 @@ NumericVector cpp_pbern(
   bool throw_warning = false;
   
   for (int i = 0; i < Nmax; i++)
-    p[i] = cdf_bernoulli(GETV(x, i), GETV(prob, i),
+    p[i] = cdf_bernoulli(as_dbl(GETV(x, i)), GETV(prob, i),
                          throw_warning);
   
   if (!lower_tail)
@@ -141,6 +154,20 @@ NumericVector cpp_pbern(
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_pbern(
+    SEXP x,
+    const NumericVector& prob,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (TYPEOF(x) == INTSXP)
+    return pbern_values(Rcpp::IntegerVector(x), prob, lower_tail, log_prob);
+  return pbern_values(NumericVector(x), prob, lower_tail, log_prob);
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_qbern(
     const NumericVector& p,
@@ -176,21 +203,21 @@ NumericVector cpp_qbern(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_rbern(
+SEXP cpp_rbern(
     const int& n,
     const NumericVector& prob
   ) {
   
-  NumericVector x(n);
+  int_values x(n);
   
   bool throw_warning = false;
   
   for (int i = 0; i < n; i++)
-    x[i] = rng_bernoulli(GETV(prob, i), throw_warning);
+    x.set(i, rng_bernoulli(GETV(prob, i), throw_warning));
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
   
-  return x;
+  return x.result();
 }
 
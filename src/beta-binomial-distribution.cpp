@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_families.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -40,21 +41,21 @@ inline double pmf_bbinom(double k, double n, double alpha,
   return R::choose(n, k) * R::beta(k+alpha, n-k+beta) / R::beta(alpha, beta);
 }
 
-inline double logpmf_bbinom(double k, double n, double alpha,
-                            double beta, bool& throw_warning) {
+double logpmf_bbinom(double k, double n, double alpha,
+                     double beta, bool& throw_warning, bool int_x) {
   if (ISNAN(k) || ISNAN(n) || ISNAN(alpha) || ISNAN(beta))
     return k+n+alpha+beta;
   if (alpha < 0.0 || beta < 0.0 || n < 0.0 || !isInteger(n, false)) {
     throw_warning = true;
     return NAN;
   }
-  if (!isInteger(k) || k < 0.0 || k > n)
+  if ((!int_x && !isInteger(k)) || k < 0.0 || k > n)
     return R_NegInf;
   return R::lchoose(n, k) + R::lbeta(k+alpha, n-k+beta) - R::lbeta(alpha, beta);
 }
 
-inline std::vector<double> cdf_bbinom_table(double k, double n,
-                                            double alpha, double beta) {
+std::vector<double> cdf_bbinom_table(double k, double n,
+                                     double alpha, double beta) {
   
   if (k < 0.0 || k > n || alpha < 0.0 || beta < 0.0)
     Rcpp::stop("inadmissible values");
@@ -101,8 +102,30 @@ inline std::vector<double> cdf_bbinom_table(double k, double n,
   return p_tab;
 }
 
-inline double rng_bbinom(double n, double alpha,
-                         double beta, bool& throw_warning) {
+// P(X <= k) as a sum of min(k+1, n-k) terms, where the upper tail is
+// summed as P(n-X <= n-k-1) for n-X following beta-binomial distribution
+// with parameters n, beta and alpha (used for quantiles beyond the
+// cached tables)
+
+inline double cdf_bbinom(double k, double n, double alpha, double beta) {
+  if (k >= n)
+    return 1.0;
+  bool upper = n - k < k + 1.0;
+  if (upper) {
+    std::swap(alpha, beta);
+    k = n - k - 1.0;
+  }
+  double lp = R::lbeta(alpha, n + beta) - R::lbeta(alpha, beta);
+  double s = 0.0;
+  for (double j = 0.0; j <= k; j += 1.0) {
+    s += exp(lp);
+    lp += log((n - j)*(j + alpha) / ((j + 1.0)*(n - j - 1.0 + beta)));
+  }
+  return upper ? 1.0 - s : s;
+}
+
+double rng_bbinom(double n, double alpha,
+                  double beta, bool& throw_warning) {
   if (ISNAN(n) || ISNAN(alpha) || ISNAN(beta) ||
       alpha < 0.0 || beta < 0.0 || n < 0.0 || !isInteger(n, false)) {
     throw_warning = true;
@@ -113,13 +136,13 @@ inline double rng_bbinom(double n, double alpha,
 }
 
 
-// [[Rcpp::export]]
-NumericVector cpp_dbbinom(
-    const NumericVector& x,
+template <typename T>
+inline NumericVector dbbinom_values(
+    const T& x,
     const NumericVector& size,
     const NumericVector& alpha,
     const NumericVector& beta,
-    const bool& log_prob = false
+    const bool& log_prob
   ) {
 
   int Nmax = std::max({
@@ -129,13 +152,14 @@ NumericVector cpp_dbbinom(
     beta.length()
   });
   NumericVector p(Nmax);
+  const bool int_values = std::is_same<T, Rcpp::IntegerVector>::value;
   
   bool throw_warning = false;
 
   for (int i = 0; i < Nmax; i++)
-    p[i] = logpmf_bbinom(GETV(x, i), GETV(size, i),
+    p[i] = logpmf_bbinom(as_dbl(GETV(x, i)), GETV(size, i),
                          GETV(alpha, i), GETV(beta, i),
-                         throw_warning);
+                         throw_warning, int_values);
 
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -148,14 +172,29 @@ NumericVector cpp_dbbinom(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_pbbinom(
-    const NumericVector& x,
+NumericVector cpp_dbbinom(
+    SEXP x,
     const NumericVector& size,
     const NumericVector& alpha,
     const NumericVector& beta,
-    const bool& lower_tail = true,
     const bool& log_prob = false
   ) {
+  
+  if (TYPEOF(x) == INTSXP)
+    return dbbinom_values(Rcpp::IntegerVector(x), size, alpha, beta, log_prob);
+  return dbbinom_values(NumericVector(x), size, alpha, beta, log_prob);
+}
+
+
+template <typename T>
+inline NumericVector pbbinom_values(
+    const T& x,
+    const NumericVector& size,
+    const NumericVector& alpha,
+    const NumericVector& beta,
+    const bool& lower_tail,
+    const bool& log_prob
+  ) {
 
   int Nmax = std::max({
     x.length(),
@@ -164,6 +203,7 @@ NumericVector cpp_pbbinom(
     beta.length()
   });
   NumericVector p(Nmax);
+  double xi;
   
   bool throw_warning = false;
   
@@ -175,18 +215,20 @@ NumericVector cpp_pbbinom(
     if (i % 1000 == 0)
       Rcpp::checkUserInterrupt();
     
-    if (ISNAN(GETV(x, i)) || ISNAN(GETV(size, i)) ||
+    xi = as_dbl(GETV(x, i));
+    
+    if (ISNAN(xi) || ISNAN(GETV(size, i)) ||
         ISNAN(GETV(alpha, i)) || ISNAN(GETV(beta, i))) {
-      p[i] = GETV(x, i) + GETV(size, i) + GETV(alpha, i) + GETV(beta, i);
+      p[i] = xi + GETV(size, i) + GETV(alpha, i) + GETV(beta, i);
     } else if (GETV(alpha, i) <= 0.0 || GETV(beta, i) <= 0.0 ||
                GETV(size, i) < 0.0 || !isInteger(GETV(size, i), false)) {
       throw_warning = true;
       p[i] = NAN;
-    } else if (GETV(x, i) < 0.0) {
+    } else if (xi < 0.0) {
       p[i] = 0.0;
-    } else if (GETV(x, i) >= GETV(size, i)) {
+    } else if (xi >= GETV(size, i)) {
       p[i] = 1.0;
-    } else if (is_large_int(GETV(x, i))) {
+    } else if (is_large_int(xi)) {
       p[i] = NA_REAL;
       Rcpp::warning("NAs introduced by coercion to integer range");
     } else {
@@ -197,7 +239,7 @@ NumericVector cpp_pbbinom(
       if (!tmp.size()) {
         tmp = cdf_bbinom_table(mx, GETV(size, i), GETV(alpha, i), GETV(beta, i));
       }
-      p[i] = tmp[to_pos_int(GETV(x, i))];
+      p[i] = tmp[to_pos_int(xi)];
       
     }
   }
@@ -216,24 +258,189 @@ NumericVector cpp_pbbinom(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_rbbinom(
+NumericVector cpp_pbbinom(
+    SEXP x,
+    const NumericVector& size,
+    const NumericVector& alpha,
+    const NumericVector& beta,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (TYPEOF(x) == INTSXP)
+    return pbbinom_values(Rcpp::IntegerVector(x), size, alpha, beta,
+                          lower_tail, log_prob);
+  return pbbinom_values(NumericVector(x), size, alpha, beta, lower_tail,
+                        log_prob);
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_qbbinom(
+    const NumericVector& p,
+    const NumericVector& size,
+    const NumericVector& alpha,
+    const NumericVector& beta,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  int Nmax = std::max({
+    p.length(),
+    size.length(),
+    alpha.length(),
+    beta.length()
+  });
+  NumericVector x(Nmax);
+  NumericVector pp = Rcpp::clone(p);
+  
+  bool throw_warning = false;
+  bool throw_large_warning = false;
+  
+  std::map<std::tuple<int, int, int>, std::vector<double>> memo;
+  double n, a, b, pi;
+  int j;
+  
+  if (log_prob)
+    pp = Rcpp::exp(pp);
+  
+  if (!lower_tail)
+    pp = 1.0 - pp;
+  
+  for (int i = 0; i < Nmax; i++) {
+    
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+    
+    n = GETV(size, i);
+    a = GETV(alpha, i);
+    b = GETV(beta, i);
+    
+    if (ISNAN(GETV(pp, i)) || ISNAN(n) || ISNAN(a) || ISNAN(b)) {
+      x[i] = GETV(pp, i) + n + a + b;
+    } else if (a <= 0.0 || b <= 0.0 || n < 0.0 || !isInteger(n, false) ||
+               !VALID_PROB(GETV(pp, i))) {
+      throw_warning = true;
+      x[i] = NAN;
+    } else if (GETV(pp, i) == 0.0) {
+      x[i] = 0.0;
+    } else if (GETV(pp, i) == 1.0) {
+      x[i] = n;
+    } else if (is_large_int(n)) {
+      throw_large_warning = true;
+      x[i] = NA_REAL;
+    } else {
+      
+      pi = GETV(pp, i);
+      std::vector<double>& tmp = memo[std::make_tuple(i % size.length(),
+                                                      i % alpha.length(),
+                                                      i % beta.length())];
+      j = search_cdf_table(pi, tmp, [=](double k) {
+        return cdf_bbinom_table(k, n, a, b);
+      }, std::min(n, QTABLE_MAX_X));
+      
+      if (j >= 0) {
+        x[i] = to_dbl(j);
+      } else if (n <= QTABLE_MAX_X) {
+        x[i] = n;
+      } else {
+        x[i] = search_cdf_bracket([=](double k) {
+          return cdf_bbinom(k, n, a, b) >= pi;
+        }, to_dbl(tmp.size() - 1), n);
+        if (x[i] < 0.0)
+          x[i] = n;
+      }
+      
+    }
+  }
+  
+  if (throw_large_warning)
+    Rcpp::warning("NAs introduced by coercion to integer range");
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return x;
+}
+
+
+// [[Rcpp::export]]
+SEXP cpp_rbbinom(
     const int& n,
     const NumericVector& size,
     const NumericVector& alpha,
     const NumericVector& beta
   ) {
 
-  NumericVector x(n);
+  int_values x(n);
   
   bool throw_warning = false;
-
-  for (int i = 0; i < n; i++)
-    x[i] = rng_bbinom(GETV(size, i), GETV(alpha, i), GETV(beta, i),
-                      throw_warning);
+  
+  int Npar = std::max({
+    size.length(),
+    alpha.length(),
+    beta.length()
+  });
+  
+  if (to_dbl(n) / to_dbl(Npar) < RNG_TABLE_MIN_REUSE) {
+    
+    for (int i = 0; i < n; i++)
+      x.set(i, rng_bbinom(GETV(size, i), GETV(alpha, i), GETV(beta, i),
+                          throw_warning));
+    
+  } else {
+    
+    // parameters are recycled, so sample by inverting cached cdf tables,
+    // the tail beyond RNG_TABLE_MAX_X is sampled by rejection
+    
+    std::map<std::tuple<int, int, int>, std::vector<double>> memo;
+    double m, a, b, max_x, u;
+    int j;
+    
+    for (int i = 0; i < n; i++) {
+      
+      m = GETV(size, i);
+      a = GETV(alpha, i);
+      b = GETV(beta, i);
+      
+      if (ISNAN(m) || ISNAN(a) || ISNAN(b) ||
+          a < 0.0 || b < 0.0 || m < 0.0 || !isInteger(m, false)) {
+        throw_warning = true;
+        x.set(i, NA_REAL);
+        continue;
+      }
+      
+      if (a == 0.0 || b == 0.0) {
+        x.set(i, rng_bbinom(m, a, b, throw_warning));
+        continue;
+      }
+      
+      std::vector<double>& tmp = memo[std::make_tuple(i % size.length(),
+                                                      i % alpha.length(),
+                                                      i % beta.length())];
+      max_x = std::min(m, RNG_TABLE_MAX_X);
+      j = search_cdf_table(rng_unif(), tmp, [=](double k) {
+        return cdf_bbinom_table(k, m, a, b);
+      }, max_x);
+      
+      if (j >= 0) {
+        x.set(i, to_dbl(j));
+      } else if (max_x == m) {
+        x.set(i, m);
+      } else {
+        do {
+          u = rng_bbinom(m, a, b, throw_warning);
+        } while (u <= max_x);
+        x.set(i, u);
+      }
+      
+    }
+    
+  }
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
 
-  return x;
+  return x.result();
 }
 
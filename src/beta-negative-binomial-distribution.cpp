@@ -42,14 +42,15 @@ inline double pmf_bnbinom(double k, double r, double alpha,
 }
 
 inline double logpmf_bnbinom(double k, double r, double alpha,
-                             double beta, bool& throw_warning) {
+                             double beta, bool& throw_warning,
+                             bool int_x = false) {
   if (ISNAN(k) || ISNAN(r) || ISNAN(alpha) || ISNAN(beta))
     return k+r+alpha+beta;
   if (alpha <= 0.0 || beta <= 0.0 || r < 0.0 || !isInteger(r, false)) {
     throw_warning = true;
     return NAN;
   }
-  if (!isInteger(k) || k < 0.0 || !R_FINITE(k))
+  if ((!int_x && !isInteger(k)) || k < 0.0 || !R_FINITE(k))
     return R_NegInf;
   return (R::lgammafn(r+k) - (R::lgammafn(k+1.0) + R::lgammafn(r))) +
     R::lbeta(alpha+r, beta+k) - R::lbeta(alpha, beta);
@@ -107,6 +108,21 @@ inline std::vector<double> cdf_bnbinom_table(double k, double r,
   return p_tab;
 }
 
+// P(X > k) = P(Y < r) for Y following beta-binomial distribution
+// with parameters r+k, alpha and beta, so it is a sum of r terms
+// for any k (used for quantiles beyond the cached tables)
+
+inline double sf_bnbinom(double k, double r, double alpha, double beta) {
+  double n = r + k;
+  double lp = R::lbeta(alpha, n + beta) - R::lbeta(alpha, beta);
+  double s = 0.0;
+  for (double j = 0.0; j < r; j += 1.0) {
+    s += exp(lp);
+    lp += log((n - j)/(j + 1.0)) + log((j + alpha)/(n - j - 1.0 + beta));
+  }
+  return s;
+}
+
 inline double rng_bnbinom(double r, double alpha,
                           double beta, bool& throw_warning) {
   if (ISNAN(r) || ISNAN(alpha) || ISNAN(beta) || alpha <= 0.0 ||
@@ -119,13 +135,13 @@ inline double rng_bnbinom(double r, double alpha,
 }
 
 
-// [[Rcpp::export]]
-NumericVector cpp_dbnbinom(
-    const NumericVector& x,
+template <typename T>
+inline NumericVector dbnbinom_values(
+    const T& x,
     const NumericVector& size,
     const NumericVector& alpha,
     const NumericVector& beta,
-    const bool& log_prob = false
+    const bool& log_prob
   ) {
 
   int Nmax = std::max({
@@ -135,12 +151,13 @@ NumericVector cpp_dbnbinom(
     beta.length()
   });
   NumericVector p(Nmax);
+  const bool int_values = std::is_same<T, Rcpp::IntegerVector>::value;
   
   bool throw_warning = false;
 
   for (int i = 0; i < Nmax; i++)
-    p[i] = logpmf_bnbinom(GETV(x, i), GETV(size, i), GETV(alpha, i),
-                          GETV(beta, i), throw_warning);
+    p[i] = logpmf_bnbinom(as_dbl(GETV(x, i)), GETV(size, i), GETV(alpha, i),
+                          GETV(beta, i), throw_warning, int_values);
 
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -153,14 +170,29 @@ NumericVector cpp_dbnbinom(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_pbnbinom(
-    const NumericVector& x,
+NumericVector cpp_dbnbinom(
+    SEXP x,
     const NumericVector& size,
     const NumericVector& alpha,
     const NumericVector& beta,
-    const bool& lower_tail = true,
     const bool& log_prob = false
   ) {
+  
+  if (TYPEOF(x) == INTSXP)
+    return dbnbinom_values(Rcpp::IntegerVector(x), size, alpha, beta, log_prob);
+  return dbnbinom_values(NumericVector(x), size, alpha, beta, log_prob);
+}
+
+
+template <typename T>
+inline NumericVector pbnbinom_values(
+    const T& x,
+    const NumericVector& size,
+    const NumericVector& alpha,
+    const NumericVector& beta,
+    const bool& lower_tail,
+    const bool& log_prob
+  ) {
 
   int Nmax = std::max({
     x.length(),
@@ -169,6 +201,7 @@ NumericVector cpp_pbnbinom(
     beta.length()
   });
   NumericVector p(Nmax);
+  double xi;
   
   bool throw_warning = false;
 
@@ -180,18 +213,20 @@ NumericVector cpp_pbnbinom(
     if (i % 1000 == 0)
       Rcpp::checkUserInterrupt();
     
-    if (ISNAN(GETV(x, i)) || ISNAN(GETV(size, i)) ||
+    xi = as_dbl(GETV(x, i));
+    
+    if (ISNAN(xi) || ISNAN(GETV(size, i)) ||
         ISNAN(GETV(alpha, i)) || ISNAN(GETV(beta, i))) {
-      p[i] = GETV(x, i) + GETV(size, i) + GETV(alpha, i) + GETV(beta, i);
+      p[i] = xi + GETV(size, i) + GETV(alpha, i) + GETV(beta, i);
     } else if (GETV(alpha, i) <= 0.0 || GETV(beta, i) <= 0.0 ||
                GETV(size, i) < 0.0 || !isInteger(GETV(size, i), false)) {
       throw_warning = true;
       p[i] = NAN;
-    } else if (GETV(x, i) < 0.0) {
+    } else if (xi < 0.0) {
       p[i] = 0.0;
-    } else if (!R_FINITE(GETV(x, i))) {
+    } else if (!R_FINITE(xi)) {
       p[i] = 1.0;
-    } else if (is_large_int(GETV(x, i))) {
+    } else if (is_large_int(xi)) {
       p[i] = NA_REAL;
       Rcpp::warning("NAs introduced by coercion to integer range");
     } else {
@@ -202,7 +237,7 @@ NumericVector cpp_pbnbinom(
       if (!tmp.size()) {
         tmp = cdf_bnbinom_table(mx, GETV(size, i), GETV(alpha, i), GETV(beta, i));
       }
-      p[i] = tmp[to_pos_int(GETV(x, i))];
+      p[i] = tmp[to_pos_int(xi)];
       
     }
   }
@@ -221,23 +256,178 @@ NumericVector cpp_pbnbinom(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_rbnbinom(
+NumericVector cpp_pbnbinom(
+    SEXP x,
+    const NumericVector& size,
+    const NumericVector& alpha,
+    const NumericVector& beta,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (TYPEOF(x) == INTSXP)
+    return pbnbinom_values(Rcpp::IntegerVector(x), size, alpha, beta,
+                           lower_tail, log_prob);
+  return pbnbinom_values(NumericVector(x), size, alpha, beta, lower_tail,
+                         log_prob);
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_qbnbinom(
+    const NumericVector& p,
+    const NumericVector& size,
+    const NumericVector& alpha,
+    const NumericVector& beta,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  int Nmax = std::max({
+    p.length(),
+    size.length(),
+    alpha.length(),
+    beta.length()
+  });
+  NumericVector x(Nmax);
+  NumericVector pp = Rcpp::clone(p);
+  
+  bool throw_warning = false;
+  
+  std::map<std::tuple<int, int, int>, std::vector<double>> memo;
+  double max_x = to_dbl(std::numeric_limits<int>::max());
+  double r, a, b, q;
+  int j;
+  
+  if (log_prob)
+    pp = Rcpp::exp(pp);
+  
+  if (!lower_tail)
+    pp = 1.0 - pp;
+  
+  for (int i = 0; i < Nmax; i++) {
+    
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+    
+    r = GETV(size, i);
+    a = GETV(alpha, i);
+    b = GETV(beta, i);
+    
+    if (ISNAN(GETV(pp, i)) || ISNAN(r) || ISNAN(a) || ISNAN(b)) {
+      x[i] = GETV(pp, i) + r + a + b;
+    } else if (a <= 0.0 || b <= 0.0 || r < 0.0 || !isInteger(r, false) ||
+               !VALID_PROB(GETV(pp, i))) {
+      throw_warning = true;
+      x[i] = NAN;
+    } else if (GETV(pp, i) == 0.0 || r == 0.0) {
+      x[i] = 0.0;
+    } else if (GETV(pp, i) == 1.0) {
+      x[i] = R_PosInf;
+    } else {
+      
+      std::vector<double>& tmp = memo[std::make_tuple(i % size.length(),
+                                                      i % alpha.length(),
+                                                      i % beta.length())];
+      j = search_cdf_table(GETV(pp, i), tmp, [=](double k) {
+        return cdf_bnbinom_table(k, r, a, b);
+      }, QTABLE_MAX_X);
+      
+      if (j >= 0) {
+        x[i] = to_dbl(j);
+      } else {
+        q = 1.0 - GETV(pp, i);
+        x[i] = search_cdf_bracket([=](double k) {
+          return sf_bnbinom(k, r, a, b) <= q;
+        }, to_dbl(tmp.size() - 1), max_x);
+        if (x[i] < 0.0)
+          x[i] = R_PosInf;
+      }
+      
+    }
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return x;
+}
+
+
+// [[Rcpp::export]]
+SEXP cpp_rbnbinom(
     const int& n,
     const NumericVector& size,
     const NumericVector& alpha,
     const NumericVector& beta
   ) {
 
-  NumericVector x(n);
+  int_values x(n);
   
   bool throw_warning = false;
-
-  for (int i = 0; i < n; i++)
-    x[i] = rng_bnbinom(GETV(size, i), GETV(alpha, i), GETV(beta, i), throw_warning);
+  
+  int Npar = std::max({
+    size.length(),
+    alpha.length(),
+    beta.length()
+  });
+  
+  if (to_dbl(n) / to_dbl(Npar) < RNG_TABLE_MIN_REUSE) {
+    
+    for (int i = 0; i < n; i++)
+      x.set(i, rng_bnbinom(GETV(size, i), GETV(alpha, i), GETV(beta, i),
+                           throw_warning));
+    
+  } else {
+    
+    // parameters are recycled, so sample by inverting cached cdf tables,
+    // the tail beyond RNG_TABLE_MAX_X is sampled by rejection
+    
+    std::map<std::tuple<int, int, int>, std::vector<double>> memo;
+    double r, a, b, u;
+    int j;
+    
+    for (int i = 0; i < n; i++) {
+      
+      r = GETV(size, i);
+      a = GETV(alpha, i);
+      b = GETV(beta, i);
+      
+      if (ISNAN(r) || ISNAN(a) || ISNAN(b) ||
+          a <= 0.0 || b <= 0.0 || r < 0.0 || !isInteger(r, false)) {
+        throw_warning = true;
+        x.set(i, NA_REAL);
+        continue;
+      }
+      
+      if (r == 0.0) {
+        x.set(i, 0.0);
+        continue;
+      }
+      
+      std::vector<double>& tmp = memo[std::make_tuple(i % size.length(),
+                                                      i % alpha.length(),
+                                                      i % beta.length())];
+      j = search_cdf_table(rng_unif(), tmp, [=](double k) {
+        return cdf_bnbinom_table(k, r, a, b);
+      }, RNG_TABLE_MAX_X);
+      
+      if (j >= 0) {
+        x.set(i, to_dbl(j));
+      } else {
+        do {
+          u = rng_bnbinom(r, a, b, throw_warning);
+        } while (u <= RNG_TABLE_MAX_X);
+        x.set(i, u);
+      }
+      
+    }
+    
+  }
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
 
-  return x;
+  return x.result();
 }
 
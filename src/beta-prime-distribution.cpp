@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_kernels.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -53,6 +54,34 @@ inline double logpdf_betapr(double x, double alpha, double beta,
   return log(pow(z, alpha-1.0)) + log(pow(z+1.0, -alpha-beta)) - R::lbeta(alpha, beta) - log(sigma);
 }
 
+// log-density and its derivatives with respect to alpha, beta, sigma,
+// written to grad; outside of the support the derivatives are zero
+
+double score_betapr(double x, double alpha, double beta, double sigma,
+                    double* grad, bool& throw_warning) {
+  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta) || ISNAN(sigma)) {
+    grad[0] = grad[1] = grad[2] = x+alpha+beta+sigma;
+    return x+alpha+beta+sigma;
+  }
+  if (alpha <= 0.0 || beta <= 0.0 || sigma <= 0.0) {
+    throw_warning = true;
+    grad[0] = grad[1] = grad[2] = NAN;
+    return NAN;
+  }
+  if (x <= 0.0 || !R_FINITE(x)) {
+    grad[0] = grad[1] = grad[2] = 0.0;
+    return R_NegInf;
+  }
+  double z = x / sigma;
+  double lz = log(z);
+  double l1z = log1p(z);
+  double dg_ab = R::digamma(alpha+beta);
+  grad[0] = lz - l1z - R::digamma(alpha) + dg_ab;
+  grad[1] = -l1z - R::digamma(beta) + dg_ab;
+  grad[2] = ((alpha+beta) * z/(1.0+z) - alpha) / sigma;
+  return lz*(alpha-1.0) - l1z*(alpha+beta) - R::lbeta(alpha, beta) - log(sigma);
+}
+
 inline double cdf_betapr(double x, double alpha, double beta,
                          double sigma, bool& throw_warning) {
   if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta) || ISNAN(sigma))
@@ -66,6 +66,31 @@ inline double cdf_bhattacharjee(double x, double mu, double sigma,
   return sigma/(2.0*a) * (G((z+a)/sigma) - G((z-a)/sigma));
 }
 
+inline double invcdf_bhattacharjee(double p, double mu, double sigma,
+                                   double a, double start,
+                                   bool& throw_warning) {
+  if (ISNAN(p) || ISNAN(mu) || ISNAN(sigma) || ISNAN(a))
+    return p+mu+sigma+a;
+  if (sigma < 0.0 || a < 0.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (sigma == 0.0)
+    return mu - a + 2.0*a*p;
+  if (a == 0.0)
+    return R::qnorm(p, mu, sigma, true, false);
+  if (p == 0.0)
+    return R_NegInf;
+  if (p == 1.0)
+    return R_PosInf;
+  if (ISNAN(start))
+    start = mu + sqrt(pow(sigma, 2.0) + pow(a, 2.0)/3.0) * InvPhi(p);
+  return invcdf_numeric(p,
+    [&](double x) { return cdf_bhattacharjee(x, mu, sigma, a, throw_warning); },
+    [&](double x) { return pdf_bhattacharjee(x, mu, sigma, a, throw_warning); },
+    R_NegInf, R_PosInf, start, throw_warning);
+}
+
 inline double rng_bhattacharjee(double mu, double sigma,
                                 double a, bool& throw_warning) {
   if (ISNAN(mu) || ISNAN(sigma) || ISNAN(a) || sigma < 0.0 || a < 0.0) {
@@ -152,6 +177,54 @@ NumericVector cpp_pbhatt(
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_qbhatt(
+    const NumericVector& p,
+    const NumericVector& mu,
+    const NumericVector& sigma,
+    const NumericVector& a,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  int Nmax = std::max({
+    p.length(),
+    mu.length(),
+    sigma.length(),
+    a.length()
+  });
+  NumericVector x(Nmax);
+  NumericVector pp = Rcpp::clone(p);
+  
+  bool throw_warning = false;
+  double start;
+  
+  if (log_prob)
+    pp = Rcpp::exp(pp);
+  
+  if (!lower_tail)
+    pp = 1.0 - pp;
+  
+  for (int i = 0; i < Nmax; i++) {
+    // warm start at the previous quantile if parameters are unchanged
+    if (i > 0 && GETV(mu, i) == GETV(mu, i-1) &&
+        GETV(sigma, i) == GETV(sigma, i-1) &&
+        GETV(a, i) == GETV(a, i-1))
+      start = x[i-1];
+    else
+      start = NAN;
+    x[i] = invcdf_bhattacharjee(GETV(pp, i), GETV(mu, i),
+                                GETV(sigma, i), GETV(a, i),
+                                start, throw_warning);
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return x;
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_rbhatt(
     const int& n,
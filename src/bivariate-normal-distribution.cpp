@@ -102,6 +102,269 @@ NumericVector cpp_dbnorm(
 }
 
 
+// Bivariate normal cdf by Drezner and Wesolowsky (1990) method with
+// Genz (2004) modifications: Gauss-Legendre quadrature of the integral
+// over the correlation (|rho| < 0.925), or of the transformed integral
+// for highly correlated variables. The quadrature nodes depend only on
+// rho, so they are computed once by bvn_nodes and then reused for
+// evaluations at different points (e.g. corners of a rectangle).
+//
+// w are the weights, for |rho| < 0.925 s are sin(asin(rho)/2 * t) and
+// u are 1-s^2 for the nodes t; otherwise s are (sqrt(1-rho^2)/2 * t)^2
+// and u are sqrt(1-s).
+
+inline void bvn_nodes(double rho, std::vector<double>& w,
+                      std::vector<double>& s, std::vector<double>& u) {
+  
+  static const double w6[3] = {
+    0.1713244923791705, 0.3607615730481384, 0.4679139345726904
+  };
+  static const double x6[3] = {
+    0.9324695142031522, 0.6612093864662647, 0.2386191860831970
+  };
+  static const double w12[6] = {
+    0.04717533638651177, 0.1069393259953183, 0.1600783285433464,
+    0.2031674267230659, 0.2334925365383547, 0.2491470458134029
+  };
+  static const double x12[6] = {
+    0.9815606342467191, 0.9041172563704750, 0.7699026741943050,
+    0.5873179542866171, 0.3678314989981802, 0.1252334085114692
+  };
+  static const double w20[10] = {
+    0.01761400713915212, 0.04060142980038694, 0.06267204833410906,
+    0.08327674157670475, 0.1019301198172404, 0.1181945319615184,
+    0.1316886384491766, 0.1420961093183821, 0.1491729864726037,
+    0.1527533871307259
+  };
+  static const double x20[10] = {
+    0.9931285991850949, 0.9639719272779138, 0.9122344282513259,
+    0.8391169718222188, 0.7463319064601508, 0.6360536807265150,
+    0.5108670019508271, 0.3737060887154196, 0.2277858511416451,
+    0.07652652113349733
+  };
+  
+  const double* wg;
+  const double* xg;
+  int ng;
+  
+  if (abs(rho) < 0.3) {
+    wg = w6;  xg = x6;  ng = 3;
+  } else if (abs(rho) < 0.75) {
+    wg = w12; xg = x12; ng = 6;
+  } else {
+    wg = w20; xg = x20; ng = 10;
+  }
+  
+  w.resize(2*ng);
+  s.resize(2*ng);
+  u.resize(2*ng);
+  
+  double t, asr, a;
+  
+  for (int j = 0; j < 2*ng; j++) {
+    w[j] = wg[j % ng];
+    t = (j < ng) ? 1.0 - xg[j] : 1.0 + xg[j - ng];
+    if (abs(rho) < 0.925) {
+      asr = std::asin(rho)/2.0;
+      s[j] = std::sin(asr*t);
+      u[j] = 1.0 - s[j]*s[j];
+    } else {
+      a = sqrt((1.0 - rho)*(1.0 + rho))/2.0;
+      s[j] = pow(a*t, 2.0);
+      u[j] = sqrt(1.0 - s[j]);
+    }
+  }
+}
+
+// P(X <= h, Y <= k) for standard bivariate normal with correlation rho
+
+inline double cdf_bnorm_std(double h, double k, double rho,
+                            const std::vector<double>& w,
+                            const std::vector<double>& s,
+                            const std::vector<double>& u) {
+  
+  if (h == R_NegInf || k == R_NegInf)
+    return 0.0;
+  if (h == R_PosInf)
+    return (k == R_PosInf) ? 1.0 : Phi(k);
+  if (k == R_PosInf)
+    return Phi(h);
+  if (rho == 0.0)
+    return Phi(h) * Phi(k);
+  
+  // upper orthant probability P(X > dh, Y > dk) for dh = -h, dk = -k
+  
+  double dh = -h, dk = -k;
+  double hk = dh*dk;
+  double bvn = 0.0;
+  int n = w.size();
+  
+  if (abs(rho) < 0.925) {
+    
+    double hs = (dh*dh + dk*dk)/2.0;
+    double asr = std::asin(rho)/2.0;
+    for (int j = 0; j < n; j++)
+      bvn += w[j] * exp((s[j]*hk - hs)/u[j]);
+    bvn = bvn*asr/(2.0*M_PI) + Phi(-dh)*Phi(-dk);
+    
+  } else {
+    
+    if (rho < 0.0) {
+      dk = -dk;
+      hk = -hk;
+    }
+    
+    if (abs(rho) < 1.0) {
+      
+      double as = (1.0 - rho)*(1.0 + rho);
+      double a = sqrt(as);
+      double bs = pow(dh - dk, 2.0);
+      double c = (4.0 - hk)/8.0;
+      double d = (12.0 - hk)/80.0;
+      double asr = -(bs/as + hk)/2.0;
+      double b, sp, ep, sum = 0.0;
+      
+      if (asr > -100.0)
+        bvn = a*exp(asr)*(1.0 - c*(bs - as)*(1.0 - d*bs)/3.0 + c*d*as*as);
+      if (hk > -100.0) {
+        b = sqrt(bs);
+        sp = SQRT_2_PI * Phi(-b/a);
+        bvn -= exp(-hk/2.0)*sp*b*(1.0 - c*bs*(1.0 - d*bs)/3.0);
+      }
+      
+      a /= 2.0;
+      for (int j = 0; j < n; j++) {
+        asr = -(bs/s[j] + hk)/2.0;
+        if (asr > -100.0) {
+          sp = 1.0 + c*s[j]*(1.0 + 5.0*d*s[j]);
+          ep = exp(-(hk/2.0)*s[j]/pow(1.0 + u[j], 2.0))/u[j];
+          sum += w[j] * exp(asr) * (sp - ep);
+        }
+      }
+      bvn = (a*sum - bvn)/(2.0*M_PI);
+      
+    }
+    
+    if (rho > 0.0) {
+      bvn += Phi(-std::max(dh, dk));
+    } else if (dh >= dk) {
+      bvn = -bvn;
+    } else {
+      if (dh < 0.0)
+        bvn = Phi(dk) - Phi(dh) - bvn;
+      else
+        bvn = Phi(-dh) - Phi(-dk) - bvn;
+    }
+    
+  }
+  
+  return std::max(0.0, std::min(1.0, bvn));
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_pbnorm(
+    const NumericVector& x,
+    const NumericVector& y,
+    const NumericVector& lower_x,
+    const NumericVector& lower_y,
+    const NumericVector& mu1,
+    const NumericVector& mu2,
+    const NumericVector& sigma1,
+    const NumericVector& sigma2,
+    const NumericVector& rho,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  int Nmax = std::max({
+    x.length(),
+    y.length(),
+    lower_x.length(),
+    lower_y.length(),
+    mu1.length(),
+    mu2.length(),
+    sigma1.length(),
+    sigma2.length(),
+    rho.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  if (x.length() != y.length())
+    Rcpp::stop("lengths of x and y differ");
+  
+  std::vector<double> w, s, u;
+  double r, last_r = NAN;
+  double h1, h2, k1, k2, tot;
+  
+  for (int i = 0; i < Nmax; i++) {
+    
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+    
+    if (ISNAN(GETV(x, i)) || ISNAN(GETV(y, i)) ||
+        ISNAN(GETV(lower_x, i)) || ISNAN(GETV(lower_y, i)) ||
+        ISNAN(GETV(mu1, i)) || ISNAN(GETV(mu2, i)) ||
+        ISNAN(GETV(sigma1, i)) || ISNAN(GETV(sigma2, i)) ||
+        ISNAN(GETV(rho, i))) {
+      p[i] = GETV(x, i) + GETV(y, i) + GETV(lower_x, i) +
+        GETV(lower_y, i) + GETV(mu1, i) + GETV(mu2, i) +
+        GETV(sigma1, i) + GETV(sigma2, i) + GETV(rho, i);
+      continue;
+    }
+    
+    r = GETV(rho, i);
+    
+    if (GETV(sigma1, i) <= 0.0 || GETV(sigma2, i) <= 0.0 ||
+        r < -1.0 || r > 1.0) {
+      throw_warning = true;
+      p[i] = NAN;
+      continue;
+    }
+    
+    h2 = (GETV(x, i) - GETV(mu1, i))/GETV(sigma1, i);
+    k2 = (GETV(y, i) - GETV(mu2, i))/GETV(sigma2, i);
+    h1 = (GETV(lower_x, i) - GETV(mu1, i))/GETV(sigma1, i);
+    k1 = (GETV(lower_y, i) - GETV(mu2, i))/GETV(sigma2, i);
+    
+    if (h2 <= h1 || k2 <= k1) {
+      p[i] = 0.0;
+      continue;
+    }
+    
+    // nodes are recomputed only when rho changes
+    
+    if (r != last_r) {
+      bvn_nodes(r, w, s, u);
+      last_r = r;
+    }
+    
+    tot = cdf_bnorm_std(h2, k2, r, w, s, u);
+    if (h1 != R_NegInf)
+      tot -= cdf_bnorm_std(h1, k2, r, w, s, u);
+    if (k1 != R_NegInf)
+      tot -= cdf_bnorm_std(h2, k1, r, w, s, u);
+    if (h1 != R_NegInf && k1 != R_NegInf)
+      tot += cdf_bnorm_std(h1, k1, r, w, s, u);
+    
+    p[i] = std::max(0.0, std::min(1.0, tot));
+  }
+  
+  if (!lower_tail)
+    p = 1.0 - p;
+  
+  if (log_prob)
+    p = Rcpp::log(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
 // [[Rcpp::export]]
 NumericMatrix cpp_rbnorm(
     const int& n,
@@ -13,8 +13,19 @@ using Rcpp::NumericVector;
 using Rcpp::NumericMatrix;
 
 
-inline double pmf_bpois(double x, double y, double a, double b, double c,
-                        bool& throw_warning) {
+/*
+ * Bivariate Poisson distribution
+ * 
+ * X = U+W, Y = V+W, where U ~ Pois(a), V ~ Pois(b), W ~ Pois(c)
+ * 
+ * a >= 0
+ * b >= 0
+ * c >= 0
+ * 
+ */
+
+inline double logpmf_bpois(double x, double y, double a, double b, double c,
+                           bool& throw_warning) {
   
   if (ISNAN(x) || ISNAN(y) || ISNAN(a) || ISNAN(b) || ISNAN(c))
     return x+y+a+b+c;
@@ -25,29 +36,181 @@ inline double pmf_bpois(double x, double y, double a, double b, double c,
   }
   
   if (!isInteger(x) || x < 0.0 || !R_FINITE(x) || !R_FINITE(y))
-    return 0.0;
+    return R_NegInf;
   
   if (!isInteger(y, false)) {
     char msg[55];
     std::snprintf(msg, sizeof(msg), "non-integer y = %f", y);
     Rcpp::warning(msg);
-    return 0.0;
+    return R_NegInf;
   }
   
   if (y < 0.0)
-    return 0.0;
+    return R_NegInf;
+  
+  // degenerate cases: some of the components are equal to zero
+  
+  if (c == 0.0)
+    return R::dpois(x, a, true) + R::dpois(y, b, true);
+  if (a == 0.0)
+    return R::dpois(x, c, true) + R::dpois(y-x, b, true);
+  if (b == 0.0)
+    return R::dpois(y, c, true) + R::dpois(x-y, a, true);
   
-  double tmp = exp(-(a+b+c)); 
-  tmp *= (pow(a, x) / factorial(x)) * (pow(b, y) / factorial(y));
+  // terms of the sum are computed relative to the first one:
+  // t[k+1]/t[k] = (x-k)*(y-k)/(k+1) * c/(a*b),
+  // the sum is accumulated in log space scaled by the largest term
   
-  double z = (x < y) ? x : y;
-  double c_ab = c/(a*b);
-  double xy = 0.0;
+  double z = std::min(x, y);
+  double lr = log(c) - log(a) - log(b);
+  double lt = 0.0, lmax = 0.0, sum = 1.0;
   
-  for (double k = 0.0; k <= z; k += 1.0)
-    xy += R::choose(x, k) * R::choose(y, k) * factorial(k) * pow(c_ab, k);
+  for (double k = 0.0; k < z; k += 1.0) {
+    lt += log((x-k)*(y-k)/(k+1.0)) + lr;
+    if (lt > lmax) {
+      sum = sum * exp(lmax - lt) + 1.0;
+      lmax = lt;
+    } else {
+      sum += exp(lt - lmax);
+    }
+  }
   
-  return tmp * xy;
+  return -(a+b+c) + x*log(a) - lfactorial(x) + y*log(b) - lfactorial(y) +
+    lmax + log(sum);
+}
+
+
+// Log-probabilities for the grid x = 0, ..., nx and y = 0, ..., ny
+// (stored row-wise, i.e. f(x, y) is at x*(ny+1)+y) computed using
+// the recurrence relations
+//
+//   x*f(x, y) = a*f(x-1, y)   + c*f(x-1, y-1)
+//   y*f(x, y) = b*f(x,   y-1) + c*f(x-1, y-1)
+//
+// (Kocherlakota and Kocherlakota, 1992) that involve only positive terms.
+
+inline std::vector<double> logpmf_bpois_table(int nx, int ny, double a,
+                                              double b, double c) {
+  
+  if (nx < 0 || ny < 0 || a < 0.0 || b < 0.0 || c < 0.0)
+    Rcpp::stop("inadmissible values");
+  
+  size_t m = static_cast<size_t>(ny) + 1;
+  std::vector<double> l_tab((static_cast<size_t>(nx) + 1) * m);
+  double la = log(a), lb = log(b), lc = log(c);
+  
+  l_tab[0] = -(a+b+c);
+  for (int j = 1; j <= ny; j++)
+    l_tab[j] = l_tab[j-1] + lb - log(to_dbl(j));
+  
+  for (int i = 1; i <= nx; i++) {
+    l_tab[i*m] = l_tab[(i-1)*m] + la - log(to_dbl(i));
+    for (int j = 1; j <= ny; j++) {
+      l_tab[i*m + j] = log_add_exp(la + l_tab[(i-1)*m + j],
+                                   lc + l_tab[(i-1)*m + j-1]) - log(to_dbl(i));
+    }
+  }
+  
+  return l_tab;
+}
+
+
+// The same recurrence on the probability scale, it is considerably faster,
+// but can be used only if f(0, 0) = exp(-(a+b+c)) does not underflow
+
+inline std::vector<double> pmf_bpois_table(int nx, int ny, double a,
+                                           double b, double c) {
+  
+  if (nx < 0 || ny < 0 || a < 0.0 || b < 0.0 || c < 0.0)
+    Rcpp::stop("inadmissible values");
+  
+  size_t m = static_cast<size_t>(ny) + 1;
+  std::vector<double> p_tab((static_cast<size_t>(nx) + 1) * m);
+  double di;
+  
+  p_tab[0] = exp(-(a+b+c));
+  for (int j = 1; j <= ny; j++)
+    p_tab[j] = p_tab[j-1] * b / to_dbl(j);
+  
+  for (int i = 1; i <= nx; i++) {
+    di = to_dbl(i);
+    p_tab[i*m] = p_tab[(i-1)*m] * a / di;
+    for (int j = 1; j <= ny; j++) {
+      p_tab[i*m + j] = (a * p_tab[(i-1)*m + j] +
+                        c * p_tab[(i-1)*m + j-1]) / di;
+    }
+  }
+  
+  return p_tab;
+}
+
+inline bool bpois_table_underflows(double a, double b, double c) {
+  return (a+b+c) > 700.0;
+}
+
+
+// Cumulative probabilities P(X <= x, Y <= y) for the grid x = 0, ..., nx
+// and y = 0, ..., ny; sums are accumulated first along y and then along x,
+// so that no subtraction is involved.
+
+inline std::vector<double> cdf_bpois_table(int nx, int ny, double a,
+                                           double b, double c) {
+  
+  size_t m = static_cast<size_t>(ny) + 1;
+  std::vector<double> p_tab;
+  
+  if (bpois_table_underflows(a, b, c)) {
+    p_tab = logpmf_bpois_table(nx, ny, a, b, c);
+    for (size_t k = 0; k < p_tab.size(); k++)
+      p_tab[k] = exp(p_tab[k]);
+  } else {
+    p_tab = pmf_bpois_table(nx, ny, a, b, c);
+  }
+  
+  for (int i = 0; i <= nx; i++) {
+    for (int j = 1; j <= ny; j++)
+      p_tab[i*m + j] += p_tab[i*m + j-1];
+    if (i > 0) {
+      for (int j = 0; j <= ny; j++)
+        p_tab[i*m + j] += p_tab[(i-1)*m + j];
+    }
+  }
+  
+  return p_tab;
+}
+
+
+// the upper bound for Poisson(lambda) beyond which the tail probability
+// is negligible
+
+inline double pois_upper_bound(double lambda) {
+  return ceil(lambda + 20.0*sqrt(lambda)) + 20.0;
+}
+
+
+// P(X <= x, Y <= y) at a single point, as the sum over the common
+// component W of P(W = w) * P(U <= x-w) * P(V <= y-w); it needs
+// O(min(x, y)) time and no memory, the terms where P(W = w) is
+// negligible are skipped
+
+inline double cdf_bpois(double x, double y, double a, double b, double c) {
+  double z = std::min(std::min(floor(x), floor(y)), pois_upper_bound(c));
+  double p = 0.0;
+  for (double w = 0.0; w <= z; w += 1.0) {
+    p += R::dpois(w, c, false) * R::ppois(x - w, a, true, false) *
+      R::ppois(y - w, b, true, false);
+  }
+  return std::min(1.0, p);
+}
+
+
+inline double bpois_max_par(const NumericVector& par) {
+  double mx = 0.0;
+  for (int i = 0; i < par.length(); i++) {
+    if (!ISNAN(par[i]) && par[i] > mx)
+      mx = par[i];
+  }
+  return mx;
 }
 
 
@@ -75,9 +238,253 @@ NumericVector cpp_dbpois(
   if (x.length() != y.length())
     Rcpp::stop("lengths of x and y differ");
   
-  for (int i = 0; i < Nmax; i++)
-    p[i] = pmf_bpois(GETV(x, i), GETV(y, i), GETV(a, i),
-                     GETV(b, i), GETV(c, i), throw_warning);
+  for (int i = 0; i < Nmax; i++) {
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+    p[i] = logpmf_bpois(GETV(x, i), GETV(y, i), GETV(a, i),
+                        GETV(b, i), GETV(c, i), throw_warning);
+  }
+  
+  if (!log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// Probabilities for all the combinations of x and y values, for each
+// of the parameter sets; values are ordered as in length(x) x length(y) x Npar
+// array
+
+// [[Rcpp::export]]
+NumericVector cpp_dbpois_grid(
+    const NumericVector& x,
+    const NumericVector& y,
+    const NumericVector& a,
+    const NumericVector& b,
+    const NumericVector& c,
+    const bool& log_prob = false
+  ) {
+  
+  int Npar = std::max({
+    a.length(),
+    b.length(),
+    c.length()
+  });
+  int nx = x.length();
+  int ny = y.length();
+  
+  if (to_dbl(nx) * to_dbl(ny) * to_dbl(Npar) > std::numeric_limits<int>::max())
+    Rcpp::stop("too many combinations of x, y and parameters");
+  
+  NumericVector p(nx * ny * Npar);
+  
+  bool throw_warning = false;
+  
+  if (x.length() == 0 || y.length() == 0 || Npar == 0)
+    return p;
+  
+  // positions of the x and y values in the table, -1 for values
+  // with zero probability, -2 for NAs
+  
+  std::vector<int> ix(nx), iy(ny);
+  int mx = 0, my = 0;
+  
+  for (int i = 0; i < nx; i++) {
+    if (ISNAN(x[i])) {
+      ix[i] = -2;
+    } else if (x[i] < 0.0 || !R_FINITE(x[i]) || !isInteger(x[i])) {
+      ix[i] = -1;
+    } else if (is_large_int(x[i])) {
+      Rcpp::stop("value out of integer range");
+    } else {
+      ix[i] = static_cast<int>(x[i]);
+      mx = std::max(mx, ix[i]);
+    }
+  }
+  
+  for (int j = 0; j < ny; j++) {
+    if (ISNAN(y[j])) {
+      iy[j] = -2;
+    } else if (y[j] < 0.0 || !R_FINITE(y[j]) || !isInteger(y[j])) {
+      iy[j] = -1;
+    } else if (is_large_int(y[j])) {
+      Rcpp::stop("value out of integer range");
+    } else {
+      iy[j] = static_cast<int>(y[j]);
+      my = std::max(my, iy[j]);
+    }
+  }
+  
+  // the table covering all the x and y values is computed only if it is
+  // not larger than the grid, otherwise the probabilities are computed
+  // separately
+  
+  bool use_table = (to_dbl(mx) + 1.0) * (to_dbl(my) + 1.0) <=
+    to_dbl(nx) * to_dbl(ny);
+  size_t m = static_cast<size_t>(my) + 1;
+  
+  std::vector<double> tab;
+  double ak, bk, ck;
+  bool log_tab;
+  int off;
+  
+  for (int k = 0; k < Npar; k++) {
+    
+    Rcpp::checkUserInterrupt();
+    
+    ak = GETV(a, k);
+    bk = GETV(b, k);
+    ck = GETV(c, k);
+    off = k * nx * ny;
+    
+    if (ISNAN(ak) || ISNAN(bk) || ISNAN(ck)) {
+      for (int l = 0; l < nx * ny; l++)
+        p[off + l] = ak + bk + ck;
+      continue;
+    } else if (ak < 0.0 || bk < 0.0 || ck < 0.0) {
+      throw_warning = true;
+      for (int l = 0; l < nx * ny; l++)
+        p[off + l] = NAN;
+      continue;
+    }
+    
+    log_tab = log_prob || bpois_table_underflows(ak, bk, ck);
+    if (!use_table)
+      log_tab = true;
+    else if (log_tab)
+      tab = logpmf_bpois_table(mx, my, ak, bk, ck);
+    else
+      tab = pmf_bpois_table(mx, my, ak, bk, ck);
+    
+    for (int j = 0; j < ny; j++) {
+      for (int i = 0; i < nx; i++) {
+        if (ix[i] == -2 || iy[j] == -2)
+          p[off + j*nx + i] = NA_REAL;
+        else if (ix[i] == -1 || iy[j] == -1)
+          p[off + j*nx + i] = log_prob ? R_NegInf : 0.0;
+        else if (!use_table)
+          p[off + j*nx + i] = logpmf_bpois(to_dbl(ix[i]), to_dbl(iy[j]),
+                                           ak, bk, ck, throw_warning);
+        else
+          p[off + j*nx + i] = tab[ix[i]*m + iy[j]];
+        if (log_tab && !log_prob && ix[i] >= 0 && iy[j] >= 0)
+          p[off + j*nx + i] = exp(p[off + j*nx + i]);
+      }
+    }
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_pbpois(
+    const NumericVector& x,
+    const NumericVector& y,
+    const NumericVector& a,
+    const NumericVector& b,
+    const NumericVector& c,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  int Nmax = std::max({
+    x.length(),
+    y.length(),
+    a.length(),
+    b.length(),
+    c.length()
+  });
+  int Npar = std::max({
+    a.length(),
+    b.length(),
+    c.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  if (x.length() != y.length())
+    Rcpp::stop("lengths of x and y differ");
+  
+  double mx = finite_max_int(x);
+  double my = finite_max_int(y);
+  double ac_max = bpois_max_par(a) + bpois_max_par(c);
+  double bc_max = bpois_max_par(b) + bpois_max_par(c);
+  
+  // when parameters are recycled, cumulative probabilities for the whole
+  // grid are computed at once, but only if the tables (one per distinct
+  // parameters) are not larger in total than the number of computed
+  // probabilities, otherwise the probabilities are computed separately
+  
+  bool use_table = to_dbl(Npar) *
+    (std::min(mx, pois_upper_bound(ac_max)) + 1.0) *
+    (std::min(my, pois_upper_bound(bc_max)) + 1.0) <= to_dbl(Nmax);
+  
+  std::map<std::tuple<int, int, int>, std::vector<double>> memo;
+  double xi, yi, ai, bi, ci;
+  int nx, ny;
+  
+  for (int i = 0; i < Nmax; i++) {
+    
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+    
+    xi = GETV(x, i);
+    yi = GETV(y, i);
+    ai = GETV(a, i);
+    bi = GETV(b, i);
+    ci = GETV(c, i);
+    
+    if (ISNAN(xi) || ISNAN(yi) || ISNAN(ai) || ISNAN(bi) || ISNAN(ci)) {
+      p[i] = xi + yi + ai + bi + ci;
+      continue;
+    } else if (ai < 0.0 || bi < 0.0 || ci < 0.0) {
+      throw_warning = true;
+      p[i] = NAN;
+      continue;
+    }
+    
+    // beyond the upper bounds of the marginals only the
+    // other marginal distribution matters
+    
+    nx = static_cast<int>(std::min(mx, pois_upper_bound(ai+ci)));
+    ny = static_cast<int>(std::min(my, pois_upper_bound(bi+ci)));
+    
+    if (xi < 0.0 || yi < 0.0) {
+      p[i] = 0.0;
+    } else if (xi == R_PosInf && yi == R_PosInf) {
+      p[i] = 1.0;
+    } else if (xi == R_PosInf) {
+      p[i] = R::ppois(yi, bi+ci, true, false);
+    } else if (yi == R_PosInf) {
+      p[i] = R::ppois(xi, ai+ci, true, false);
+    } else if (!use_table) {
+      p[i] = cdf_bpois(xi, yi, ai, bi, ci);
+    } else {
+      
+      std::vector<double>& tmp = memo[std::make_tuple(i % a.length(),
+                                                      i % b.length(),
+                                                      i % c.length())];
+      if (!tmp.size()) {
+        tmp = cdf_bpois_table(nx, ny, ai, bi, ci);
+      }
+      p[i] = std::min(1.0, tmp[static_cast<size_t>(std::min(floor(xi), to_dbl(nx))) *
+                               (static_cast<size_t>(ny) + 1) +
+                               static_cast<size_t>(std::min(floor(yi), to_dbl(ny)))]);
+      
+    }
+  }
+  
+  if (!lower_tail)
+    p = 1.0 - p;
   
   if (log_prob)
     p = Rcpp::log(p);
@@ -90,14 +497,14 @@ NumericVector cpp_dbpois(
 
 
 // [[Rcpp::export]]
-NumericMatrix cpp_rbpois(
+SEXP cpp_rbpois(
     const int& n,
     const NumericVector& a,
     const NumericVector& b,
     const NumericVector& c
   ) {
   
-  NumericMatrix x(n, 2);
+  int_values x(n, 2);
   double u, v, w;
   
   bool throw_warning = false;
@@ -106,20 +513,20 @@ NumericMatrix cpp_rbpois(
     if (ISNAN(GETV(a, i)) || ISNAN(GETV(b, i)) || ISNAN(GETV(c, i)) || 
         GETV(a, i) < 0.0 || GETV(b, i) < 0.0 || GETV(c, i) < 0.0) {
       throw_warning = true;
-      x(i, 0) = NA_REAL;
-      x(i, 1) = NA_REAL;
+      x.set(i, 0, NA_REAL);
+      x.set(i, 1, NA_REAL);
     } else {
       u = R::rpois(GETV(a, i));
       v = R::rpois(GETV(b, i));
       w = R::rpois(GETV(c, i));
-      x(i, 0) = u+w;
-      x(i, 1) = v+w;
+      x.set(i, 0, u+w);
+      x.set(i, 1, v+w);
     }
   }
 
   if (throw_warning)
     Rcpp::warning("NAs produced");
   
-  return x;
+  return x.result();
 }
 
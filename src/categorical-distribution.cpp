@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include <type_traits>
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -26,11 +27,14 @@ using Rcpp::NumericMatrix;
 */
 
 
-// [[Rcpp::export]]
-NumericVector cpp_dcat(
-    const NumericVector& x,
+// x is either an integer or a double vector; integer vectors are read
+// in place and their values need not be checked for being integers
+
+template <typename T>
+inline NumericVector dcat_values(
+    const T& x,
     const NumericMatrix& prob,
-    const bool& log_prob = false
+    bool log_prob
   ) {
   
   int Nmax = std::max({
@@ -39,7 +43,8 @@ NumericVector cpp_dcat(
   });
   int k = prob.ncol();
   NumericVector p(Nmax);
-  double p_tot;
+  double p_tot, xi;
+  const bool int_values = std::is_same<T, Rcpp::IntegerVector>::value;
   
   bool throw_warning = false;
   
@@ -65,20 +70,16 @@ NumericVector cpp_dcat(
   }
   
   for (int i = 0; i < Nmax; i++) {
-    if (ISNAN(GETV(x, i))) {
-      p[i] = GETV(x, i);
+    xi = as_dbl(GETV(x, i));
+    if (ISNAN(xi)) {
+      p[i] = xi;
       continue;
     }
-    if (!isInteger(GETV(x, i)) || GETV(x, i) < 1.0 ||
-        GETV(x, i) > to_dbl(k)) {
+    if ((!int_values && !isInteger(xi)) || xi < 1.0 || xi > to_dbl(k)) {
       p[i] = 0.0;
       continue;
     }
-    if (is_large_int(GETV(x, i))) {
-      Rcpp::warning("NAs introduced by coercion to integer range");
-      p[i] = NA_REAL;
-    }
-    p[i] = GETM(prob_tab, i, to_pos_int(GETV(x, i)) - 1);
+    p[i] = GETM(prob_tab, i, static_cast<int>(xi) - 1);
   }
 
   if (log_prob)
@@ -92,10 +93,23 @@ NumericVector cpp_dcat(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_pcat(
-    const NumericVector& x,
+NumericVector cpp_dcat(
+    SEXP x,
     const NumericMatrix& prob,
-    bool lower_tail = true, bool log_prob = false
+    const bool& log_prob = false
+  ) {
+  
+  if (TYPEOF(x) == INTSXP)
+    return dcat_values(Rcpp::IntegerVector(x), prob, log_prob);
+  return dcat_values(NumericVector(x), prob, log_prob);
+}
+
+
+template <typename T>
+inline NumericVector pcat_values(
+    const T& x,
+    const NumericMatrix& prob,
+    bool lower_tail, bool log_prob
   ) {
   
   int Nmax = std::max({
@@ -104,7 +118,7 @@ NumericVector cpp_pcat(
   });
   int k = prob.ncol();
   NumericVector p(Nmax);
-  double p_tot;
+  double p_tot, xi;
   
   bool throw_warning = false;
 
@@ -133,23 +147,20 @@ NumericVector cpp_pcat(
   }
   
   for (int i = 0; i < Nmax; i++) {
-    if (ISNAN(GETV(x, i))) {
-      p[i] = GETV(x, i);
+    xi = as_dbl(GETV(x, i));
+    if (ISNAN(xi)) {
+      p[i] = xi;
       continue;
     }
-    if (GETV(x, i) < 1.0) {
+    if (xi < 1.0) {
       p[i] = 0.0;
       continue;
     }
-    if (GETV(x, i) >= to_dbl(k)) {
+    if (xi >= to_dbl(k)) {
       p[i] = 1.0;
       continue;
     }
-    if (is_large_int(GETV(x, i))) {
-      Rcpp::warning("NAs introduced by coercion to integer range");
-      p[i] = NA_REAL;
-    }
-    p[i] = GETM(prob_tab, i, to_pos_int(GETV(x, i)) - 1);
+    p[i] = GETM(prob_tab, i, static_cast<int>(xi) - 1);
   }
 
   if (!lower_tail)
@@ -165,6 +176,19 @@ NumericVector cpp_pcat(
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_pcat(
+    SEXP x,
+    const NumericMatrix& prob,
+    bool lower_tail = true, bool log_prob = false
+  ) {
+  
+  if (TYPEOF(x) == INTSXP)
+    return pcat_values(Rcpp::IntegerVector(x), prob, lower_tail, log_prob);
+  return pcat_values(NumericVector(x), prob, lower_tail, log_prob);
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_qcat(
     const NumericVector& p,
@@ -256,13 +280,14 @@ NumericVector cpp_qcat(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_rcat(
+Rcpp::IntegerVector cpp_rcat(
     const int& n,
-    const NumericMatrix& prob
+    const NumericMatrix& prob,
+    SEXP out = R_NilValue
   ) {
   
   int k = prob.ncol();
-  NumericVector x(n);
+  Rcpp::IntegerVector x = output_int_vector(out, n);
   int jj;
   double u, p_tot;
   
@@ -294,7 +319,7 @@ NumericVector cpp_rcat(
   
   for (int i = 0; i < n; i++) {
     if (ISNAN(GETM(prob_tab, i , 0))) {
-      x[i] = GETM(prob_tab, i, 0);
+      x[i] = NA_INTEGER;
       continue;
     }
     
@@ -307,7 +332,9 @@ NumericVector cpp_rcat(
         break;
       }
     }
-    x[i] = to_dbl(jj);
+    if (sampler_diag.enabled())
+      sampler_diag.record("cat: linear search", to_dbl(jj));
+    x[i] = jj;
   }
   
   if (throw_warning)
@@ -316,3 +343,18 @@ NumericVector cpp_rcat(
   return x;
 }
 
+
+
+// Copies the values drawn by sample.int in rcat (for vector prob) into
+// out, so that they are the same whether or not out is used
+
+// [[Rcpp::export]]
+Rcpp::IntegerVector cpp_rcat_fill(
+    const Rcpp::IntegerVector& x,
+    SEXP out = R_NilValue
+  ) {
+  Rcpp::IntegerVector res = output_int_vector(out, x.length());
+  std::copy(x.begin(), x.end(), res.begin());
+  return res;
+}
+
@@ -0,0 +1,89 @@
+#include <Rcpp.h>
+#include "shared.h"
+#include "shared_kernels.h"
+// [[Rcpp::plugins(cpp11)]]
+
+using Rcpp::NumericVector;
+
+
+/*
+ *  Contributions of censored observations to the likelihood
+ *
+ *  Values:
+ *  x
+ *  status (0 - right censored, 1 - observed, 2 - left censored)
+ *
+ *  Parameters:
+ *  list of vectors of parameters of the distribution
+ *
+ *  l(x) = { 1-F(x)   if status = 0
+ *         { f(x)     if status = 1
+ *         { F(x)     if status = 2
+ *
+ *  The kernels compute the value appropriate for the status in the log
+ *  scale, and the terms shared by f and F (standardized values,
+ *  truncation masses, cumulative hazards) are computed once per value.
+ *
+ *  The kernels are described by the structs in shared_kernels.h.
+ *
+ */
+
+
+struct censored_op {
+  const NumericVector& x;
+  const NumericVector& status;
+  const std::vector<NumericVector>& params;
+  bool log_prob;
+  template <typename C> NumericVector run() const {
+    
+    if (static_cast<int>(params.size()) != C::npar)
+      Rcpp::stop("wrong number of parameters");
+    
+    R_xlen_t Nmax = std::max(x.length(), status.length());
+    bool empty = x.length() < 1 || status.length() < 1;
+    for (int m = 0; m < C::npar; m++) {
+      empty = empty || params[m].length() < 1;
+      Nmax = std::max(Nmax, params[m].length());
+    }
+    if (empty)
+      return NumericVector(0);
+    
+    NumericVector p(Nmax);
+    double par[C::npar];
+    bool throw_warning = false;
+    
+    for (R_xlen_t i = 0; i < Nmax; i++) {
+      
+      if (i % 1000 == 0)
+        Rcpp::checkUserInterrupt();
+      
+      for (int m = 0; m < C::npar; m++)
+        par[m] = params[m][i % params[m].length()];
+      
+      p[i] = C::logcens(GETV(x, i), GETV(status, i), par, throw_warning);
+    }
+    
+    if (!log_prob)
+      p = Rcpp::exp(p);
+    
+    if (throw_warning)
+      Rcpp::warning("NaNs produced");
+    
+    return p;
+  }
+};
+
+
+// [[Rcpp::export]]
+NumericVector cpp_dcens(
+    const NumericVector& x,
+    const NumericVector& status,
+    const std::string& family,
+    const Rcpp::List& params,
+    const bool& log_prob = false
+  ) {
+  
+  std::vector<NumericVector> par_list = param_list(params);
+  
+  return dispatch_censored(family, censored_op{ x, status, par_list, log_prob });
+}
@@ -107,11 +107,12 @@ NumericVector cpp_ddirichlet(
 // [[Rcpp::export]]
 NumericMatrix cpp_rdirichlet(
     const int& n,
-    const NumericMatrix& alpha
+    const NumericMatrix& alpha,
+    SEXP out = R_NilValue
   ) {
 
   int k = alpha.ncol();
-  NumericMatrix x(n, k);
+  NumericMatrix x = output_matrix(out, n, k);
   
   bool throw_warning = false;
   
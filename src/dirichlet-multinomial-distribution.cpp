@@ -112,21 +112,21 @@ NumericVector cpp_ddirmnom(
 
 
 // [[Rcpp::export]]
-NumericMatrix cpp_rdirmnom(
+SEXP cpp_rdirmnom(
     const int& n,
     const NumericVector& size,
     const NumericMatrix& alpha
   ) {
   
   int k = alpha.ncol();
-  NumericMatrix x(n, k);
+  int_values x(n, k);
   
   bool throw_warning = false;
   
   if (k < 2)
     Rcpp::stop("Number of columns in alpha should be >= 2");
   
-  double size_left, row_sum, sum_p, p_tmp, sum_alpha;
+  double size_left, row_sum, sum_p, p_tmp, sum_alpha, u;
   bool wrong_values;
   
   for (int i = 0; i < n; i++) {
@@ -152,13 +152,13 @@ NumericMatrix cpp_rdirmnom(
         GETV(size, i) < 0.0 || !isInteger(GETV(size, i), false)) {
       throw_warning = true;
       for (int j = 0; j < k; j++)
-        x(i, j) = NA_REAL;
+        x.set(i, j, NA_REAL);
       continue;
     }
     
     if (GETV(size, i) == 0.0) {
       for (int j = 0; j < k; j++)
-        x(i, j) = 0.0;
+        x.set(i, j, 0.0);
       continue;
     } 
     
@@ -166,18 +166,19 @@ NumericMatrix cpp_rdirmnom(
     
     for (int j = 0; j < k-1; j++) {
       p_tmp = pi[j] / row_sum;
-      x(i, j) = R::rbinom(size_left, p_tmp/sum_p);
-      size_left -= x(i, j);
+      u = R::rbinom(size_left, p_tmp/sum_p);
+      x.set(i, j, u);
+      size_left -= u;
       sum_p -= p_tmp;
     }
     
-    x(i, k-1) = size_left;
+    x.set(i, k-1, size_left);
     
   }
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
   
-  return x;
+  return x.result();
 }
 
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_discretize.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -13,60 +14,103 @@ using Rcpp::NumericVector;
 
 
 /*
-* Discrete normal distribution
+* Discrete gamma distribution
 * 
 * Values:
-* x
+* x >= 0
 * 
 * Parameters
-* mu
-* sigma > 0
+* shape > 0
+* scale > 0
+* 
+* f(x)    = G(x+1) - G(x)
+* F(x)    = G(floor(x)+1)
+* F^-1(p) = max(ceiling(G^-1(p)) - 1, 0)
+* 
+* where G is the distribution function of the gamma distribution
 *  
 */
 
 
-inline double pmf_dgamma(double x, double shape, double scale,
-                         bool& throw_warning) {
-  if (ISNAN(x) || ISNAN(shape) || ISNAN(scale))
-    return x+shape+scale;
-  if (shape <= 0.0 || scale <= 0) {
-    throw_warning = true;
-    return NAN;
-  }
-  if (x < 0.0 || !isInteger(x))
+struct discretized_gamma {
+  static const int npar = 2;
+  static double support_min() {
     return 0.0;
-  return R::pgamma(x+1.0, shape, scale, true, false) -
-    R::pgamma(x, shape, scale, true, false);
-}
+  }
+  static bool valid(const double* par) {
+    return par[0] > 0.0 && par[1] > 0.0;
+  }
+  static double center(const double* par) {
+    return par[0] * par[1];
+  }
+  static double cdf(double x, const double* par, bool lower_tail, bool log_p) {
+    return R::pgamma(x, par[0], par[1], lower_tail, log_p);
+  }
+  static double invcdf(double p, const double* par, bool lower_tail, bool log_p) {
+    return R::qgamma(p, par[0], par[1], lower_tail, log_p);
+  }
+  static double rng(const double* par) {
+    return R::rgamma(par[0], par[1]);
+  }
+};
 
 
 // [[Rcpp::export]]
 NumericVector cpp_ddgamma(
-    const NumericVector& x,
+    SEXP x,
     const NumericVector& shape,
     const NumericVector& scale,
     const bool& log_prob = false
   ) {
   
-  int Nmax = std::max({
-    x.length(),
-    shape.length(),
-    scale.length()
-  });
-  NumericVector p(Nmax);
-  
-  bool throw_warning = false;
-  
-  for (int i = 0; i < Nmax; i++)
-    p[i] = pmf_dgamma(GETV(x, i), GETV(shape, i),
-                      GETV(scale, i), throw_warning);
+  std::vector<NumericVector> params = { shape, scale };
+  if (TYPEOF(x) == INTSXP)
+    return discretized_pdf<discretized_gamma>(Rcpp::IntegerVector(x), params,
+                                              log_prob);
+  return discretized_pdf<discretized_gamma>(NumericVector(x), params, log_prob);
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_pdgamma(
+    SEXP x,
+    const NumericVector& shape,
+    const NumericVector& scale,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
   
-  if (log_prob)
-    p = Rcpp::log(p);
+  std::vector<NumericVector> params = { shape, scale };
+  if (TYPEOF(x) == INTSXP)
+    return discretized_cdf<discretized_gamma>(Rcpp::IntegerVector(x), params,
+                                              lower_tail, log_prob);
+  return discretized_cdf<discretized_gamma>(NumericVector(x), params,
+                                            lower_tail, log_prob);
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_qdgamma(
+    const NumericVector& p,
+    const NumericVector& shape,
+    const NumericVector& scale,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
   
-  if (throw_warning)
-    Rcpp::warning("NaNs produced");
+  std::vector<NumericVector> params = { shape, scale };
+  return discretized_invcdf<discretized_gamma>(p, params, lower_tail, log_prob);
+}
+
+
+// [[Rcpp::export]]
+SEXP cpp_rdgamma(
+    const int& n,
+    const NumericVector& shape,
+    const NumericVector& scale
+  ) {
   
-  return p;
+  std::vector<NumericVector> params = { shape, scale };
+  return discretized_rng<discretized_gamma>(n, params);
 }
 
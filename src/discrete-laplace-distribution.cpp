@@ -13,14 +13,14 @@ using Rcpp::NumericVector;
 
 
 inline double pmf_dlaplace(double x, double p, double mu,
-                           bool& throw_warning) {
+                           bool& throw_warning, bool int_x = false) {
   if (ISNAN(x) || ISNAN(p) || ISNAN(mu))
     return x+p+mu;
   if (p <= 0.0 || p >= 1.0) {
     throw_warning = true;
     return NAN;
   }
-  if (!isInteger(x))
+  if (!int_x && !isInteger(x))
     return 0.0;
   return (1.0-p)/(1.0+p) * pow(p, abs(x-mu));
 } 
@@ -53,12 +53,12 @@ inline double rng_dlaplace(double p, double mu,
 } 
 
 
-// [[Rcpp::export]]
-NumericVector cpp_ddlaplace(
-    const NumericVector& x,
+template <typename T>
+inline NumericVector ddlaplace_values(
+    const T& x,
     const NumericVector& location,
     const NumericVector& scale,
-    const bool& log_prob = false
+    const bool& log_prob
   ) {
   
   int Nmax = std::max({
@@ -67,12 +67,13 @@ NumericVector cpp_ddlaplace(
     location.length()
   });
   NumericVector p(Nmax);
+  const bool int_values = std::is_same<T, Rcpp::IntegerVector>::value;
   
   bool throw_warning = false;
   
   for (int i = 0; i < Nmax; i++)
-    p[i] = pmf_dlaplace(GETV(x, i), GETV(scale, i),
-                        GETV(location, i), throw_warning);
+    p[i] = pmf_dlaplace(as_dbl(GETV(x, i)), GETV(scale, i),
+                        GETV(location, i), throw_warning, int_values);
   
   if (log_prob)
     p = Rcpp::log(p);
@@ -85,14 +86,28 @@ NumericVector cpp_ddlaplace(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_pdlaplace(
-    const NumericVector& x,
+NumericVector cpp_ddlaplace(
+    SEXP x,
     const NumericVector& location,
     const NumericVector& scale,
-    const bool& lower_tail = true,
     const bool& log_prob = false
   ) {
   
+  if (TYPEOF(x) == INTSXP)
+    return ddlaplace_values(Rcpp::IntegerVector(x), location, scale, log_prob);
+  return ddlaplace_values(NumericVector(x), location, scale, log_prob);
+}
+
+
+template <typename T>
+inline NumericVector pdlaplace_values(
+    const T& x,
+    const NumericVector& location,
+    const NumericVector& scale,
+    const bool& lower_tail,
+    const bool& log_prob
+  ) {
+  
   int Nmax = std::max({
     x.length(),
     scale.length(),
@@ -103,7 +118,7 @@ NumericVector cpp_pdlaplace(
   bool throw_warning = false;
   
   for (int i = 0; i < Nmax; i++)
-    p[i] = cdf_dlaplace(GETV(x, i), GETV(scale, i),
+    p[i] = cdf_dlaplace(as_dbl(GETV(x, i)), GETV(scale, i),
                         GETV(location, i), throw_warning);
   
   if (!lower_tail)
@@ -120,22 +135,39 @@ NumericVector cpp_pdlaplace(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_rdlaplace(
+NumericVector cpp_pdlaplace(
+    SEXP x,
+    const NumericVector& location,
+    const NumericVector& scale,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (TYPEOF(x) == INTSXP)
+    return pdlaplace_values(Rcpp::IntegerVector(x), location, scale,
+                            lower_tail, log_prob);
+  return pdlaplace_values(NumericVector(x), location, scale, lower_tail,
+                          log_prob);
+}
+
+
+// [[Rcpp::export]]
+SEXP cpp_rdlaplace(
     const int& n,
     const NumericVector& location,
     const NumericVector& scale
   ) {
   
-  NumericVector x(n);
+  int_values x(n);
   
   bool throw_warning = false;
   
   for (int i = 0; i < n; i++)
-    x[i] = rng_dlaplace(GETV(scale, i), GETV(location, i),
-                        throw_warning);
+    x.set(i, rng_dlaplace(GETV(scale, i), GETV(location, i),
+                          throw_warning));
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
   
-  return x;
+  return x.result();
 }
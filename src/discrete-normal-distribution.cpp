@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_discretize.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -21,52 +22,93 @@ using Rcpp::NumericVector;
 * Parameters
 * mu
 * sigma > 0
+* 
+* f(x)    = Phi((x-mu+1)/sigma) - Phi((x-mu)/sigma)
+* F(x)    = Phi((floor(x)+1-mu)/sigma)
+* F^-1(p) = ceiling(mu + sigma * Phi^-1(p)) - 1
 *  
 */
 
 
-inline double pmf_dnorm(double x, double mu, double sigma,
-                        bool& throw_warning) {
-  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma))
-    return x+mu+sigma;
-  if (sigma <= 0.0) {
-    throw_warning = true;
-    return NAN;
+struct discretized_norm {
+  static const int npar = 2;
+  static double support_min() {
+    return R_NegInf;
   }
-  if (!isInteger(x))
-    return 0.0;
-  return R::pnorm(x+1.0, mu, sigma, true, false) -
-         R::pnorm(x, mu, sigma, true, false);
-}
+  static bool valid(const double* par) {
+    return par[1] > 0.0;
+  }
+  static double center(const double* par) {
+    return par[0];
+  }
+  static double cdf(double x, const double* par, bool lower_tail, bool log_p) {
+    return R::pnorm(x, par[0], par[1], lower_tail, log_p);
+  }
+  static double invcdf(double p, const double* par, bool lower_tail, bool log_p) {
+    return R::qnorm(p, par[0], par[1], lower_tail, log_p);
+  }
+  static double rng(const double* par) {
+    return R::rnorm(par[0], par[1]);
+  }
+};
 
 
 // [[Rcpp::export]]
 NumericVector cpp_ddnorm(
-    const NumericVector& x,
+    SEXP x,
     const NumericVector& mu,
     const NumericVector& sigma,
     const bool& log_prob = false
   ) {
   
-  int Nmax = std::max({
-    x.length(),
-    mu.length(),
-    sigma.length()
-  });
-  NumericVector p(Nmax);
-  
-  bool throw_warning = false;
-  
-  for (int i = 0; i < Nmax; i++)
-    p[i] = pmf_dnorm(GETV(x, i), GETV(mu, i),
-                     GETV(sigma, i), throw_warning);
+  std::vector<NumericVector> params = { mu, sigma };
+  if (TYPEOF(x) == INTSXP)
+    return discretized_pdf<discretized_norm>(Rcpp::IntegerVector(x), params,
+                                             log_prob);
+  return discretized_pdf<discretized_norm>(NumericVector(x), params, log_prob);
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_pdnorm(
+    SEXP x,
+    const NumericVector& mu,
+    const NumericVector& sigma,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
   
-  if (log_prob)
-    p = Rcpp::log(p);
+  std::vector<NumericVector> params = { mu, sigma };
+  if (TYPEOF(x) == INTSXP)
+    return discretized_cdf<discretized_norm>(Rcpp::IntegerVector(x), params,
+                                             lower_tail, log_prob);
+  return discretized_cdf<discretized_norm>(NumericVector(x), params,
+                                           lower_tail, log_prob);
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_qdnorm(
+    const NumericVector& p,
+    const NumericVector& mu,
+    const NumericVector& sigma,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
   
-  if (throw_warning)
-    Rcpp::warning("NaNs produced");
+  std::vector<NumericVector> params = { mu, sigma };
+  return discretized_invcdf<discretized_norm>(p, params, lower_tail, log_prob);
+}
+
+
+// [[Rcpp::export]]
+SEXP cpp_rdnorm(
+    const int& n,
+    const NumericVector& mu,
+    const NumericVector& sigma
+  ) {
   
-  return p;
+  std::vector<NumericVector> params = { mu, sigma };
+  return discretized_rng<discretized_norm>(n, params);
 }
 
@@ -25,7 +25,7 @@ using Rcpp::NumericVector;
 
 
 inline double pmf_dunif(double x, double min, double max,
-                        bool& throw_warning) {
+                        bool& throw_warning, bool int_x = false) {
   if (ISNAN(x) || ISNAN(min) || ISNAN(max))
     return x+min+max;
   if (min > max || !R_FINITE(min) || !R_FINITE(max) ||
@@ -33,7 +33,7 @@ inline double pmf_dunif(double x, double min, double max,
     throw_warning = true;
     return NAN;
   }
-  if (x < min || x > max || !isInteger(x))
+  if (x < min || x > max || (!int_x && !isInteger(x)))
     return 0.0;
   return 1.0/(max-min+1.0);
 }
@@ -83,12 +83,12 @@ inline double rng_dunif(double min, double max, bool& throw_warning) {
 }
 
 
-// [[Rcpp::export]]
-NumericVector cpp_ddunif(
-    const NumericVector& x,
+template <typename T>
+inline NumericVector ddunif_values(
+    const T& x,
     const NumericVector& min,
     const NumericVector& max,
-    const bool& log_prob = false
+    const bool& log_prob
   ) {
   
   int Nmax = std::max({
@@ -97,12 +97,13 @@ NumericVector cpp_ddunif(
     max.length()
   });
   NumericVector p(Nmax);
+  const bool int_values = std::is_same<T, Rcpp::IntegerVector>::value;
   
   bool throw_warning = false;
   
   for (int i = 0; i < Nmax; i++)
-    p[i] = pmf_dunif(GETV(x, i), GETV(min, i),
-                     GETV(max, i), throw_warning);
+    p[i] = pmf_dunif(as_dbl(GETV(x, i)), GETV(min, i),
+                     GETV(max, i), throw_warning, int_values);
   
   if (log_prob)
     p = Rcpp::log(p);
@@ -115,14 +116,28 @@ NumericVector cpp_ddunif(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_pdunif(
-    const NumericVector& x,
+NumericVector cpp_ddunif(
+    SEXP x,
     const NumericVector& min,
     const NumericVector& max,
-    const bool& lower_tail = true,
     const bool& log_prob = false
   ) {
   
+  if (TYPEOF(x) == INTSXP)
+    return ddunif_values(Rcpp::IntegerVector(x), min, max, log_prob);
+  return ddunif_values(NumericVector(x), min, max, log_prob);
+}
+
+
+template <typename T>
+inline NumericVector pdunif_values(
+    const T& x,
+    const NumericVector& min,
+    const NumericVector& max,
+    const bool& lower_tail,
+    const bool& log_prob
+  ) {
+  
   int Nmax = std::max({
     x.length(),
     min.length(),
@@ -133,7 +148,7 @@ NumericVector cpp_pdunif(
   bool throw_warning = false;
   
   for (int i = 0; i < Nmax; i++)
-    p[i] = cdf_dunif(GETV(x, i), GETV(min, i),
+    p[i] = cdf_dunif(as_dbl(GETV(x, i)), GETV(min, i),
                      GETV(max, i), throw_warning);
   
   if (!lower_tail)
@@ -149,6 +164,22 @@ NumericVector cpp_pdunif(
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_pdunif(
+    SEXP x,
+    const NumericVector& min,
+    const NumericVector& max,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (TYPEOF(x) == INTSXP)
+    return pdunif_values(Rcpp::IntegerVector(x), min, max, lower_tail,
+                         log_prob);
+  return pdunif_values(NumericVector(x), min, max, lower_tail, log_prob);
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_qdunif(
     const NumericVector& p,
@@ -186,23 +217,23 @@ NumericVector cpp_qdunif(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_rdunif(
+SEXP cpp_rdunif(
     const int& n,
     const NumericVector& min,
     const NumericVector& max
   ) {
   
-  NumericVector x(n);
+  int_values x(n);
   
   bool throw_warning = false;
   
   for (int i = 0; i < n; i++)
-    x[i] = rng_dunif(GETV(min, i), GETV(max, i),
-                     throw_warning);
+    x.set(i, rng_dunif(GETV(min, i), GETV(max, i),
+                       throw_warning));
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
   
-  return x;
+  return x.result();
 }
 
@@ -32,14 +32,14 @@ using Rcpp::NumericVector;
 */
 
 inline double pdf_dweibull(double x, double q, double beta,
-                           bool& throw_warning) {
+                           bool& throw_warning, bool int_x = false) {
   if (ISNAN(x) || ISNAN(q) || ISNAN(beta))
     return x+q+beta;
   if (q <= 0.0 || q >= 1.0 || beta <= 0.0) {
     throw_warning = true;
     return NAN;
   }
-  if (!isInteger(x) || x < 0.0)
+  if ((!int_x && !isInteger(x)) || x < 0.0)
     return 0.0;
   return pow(q, pow(x, beta)) - pow(q, pow(x+1.0, beta));
 }
@@ -82,12 +82,12 @@ inline double rng_dweibull(double q, double beta,
 }
 
 
-// [[Rcpp::export]]
-NumericVector cpp_ddweibull(
-    const NumericVector& x,
+template <typename T>
+inline NumericVector ddweibull_values(
+    const T& x,
     const NumericVector& q,
     const NumericVector& beta,
-    const bool& log_prob = false
+    const bool& log_prob
   ) {
 
   int Nmax = std::max({
@@ -96,12 +96,13 @@ NumericVector cpp_ddweibull(
     beta.length()
   });
   NumericVector p(Nmax);
+  const bool int_values = std::is_same<T, Rcpp::IntegerVector>::value;
   
   bool throw_warning = false;
 
   for (int i = 0; i < Nmax; i++)
-    p[i] = pdf_dweibull(GETV(x, i), GETV(q, i),
-                        GETV(beta, i), throw_warning);
+    p[i] = pdf_dweibull(as_dbl(GETV(x, i)), GETV(q, i),
+                        GETV(beta, i), throw_warning, int_values);
 
   if (log_prob)
     p = Rcpp::log(p);
@@ -114,13 +115,27 @@ NumericVector cpp_ddweibull(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_pdweibull(
-    const NumericVector& x,
+NumericVector cpp_ddweibull(
+    SEXP x,
     const NumericVector& q,
     const NumericVector& beta,
-    const bool& lower_tail = true,
     const bool& log_prob = false
   ) {
+  
+  if (TYPEOF(x) == INTSXP)
+    return ddweibull_values(Rcpp::IntegerVector(x), q, beta, log_prob);
+  return ddweibull_values(NumericVector(x), q, beta, log_prob);
+}
+
+
+template <typename T>
+inline NumericVector pdweibull_values(
+    const T& x,
+    const NumericVector& q,
+    const NumericVector& beta,
+    const bool& lower_tail,
+    const bool& log_prob
+  ) {
 
   int Nmax = std::max({
     x.length(),
@@ -132,7 +147,7 @@ NumericVector cpp_pdweibull(
   bool throw_warning = false;
 
   for (int i = 0; i < Nmax; i++)
-    p[i] = cdf_dweibull(GETV(x, i), GETV(q, i),
+    p[i] = cdf_dweibull(as_dbl(GETV(x, i)), GETV(q, i),
                         GETV(beta, i), throw_warning);
 
   if (!lower_tail)
@@ -148,6 +163,22 @@ NumericVector cpp_pdweibull(
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_pdweibull(
+    SEXP x,
+    const NumericVector& q,
+    const NumericVector& beta,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (TYPEOF(x) == INTSXP)
+    return pdweibull_values(Rcpp::IntegerVector(x), q, beta, lower_tail,
+                            log_prob);
+  return pdweibull_values(NumericVector(x), q, beta, lower_tail, log_prob);
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_qdweibull(
     const NumericVector& p,
@@ -185,23 +216,23 @@ NumericVector cpp_qdweibull(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_rdweibull(
+SEXP cpp_rdweibull(
     const int& n,
     const NumericVector& q,
     const NumericVector& beta
   ) {
 
-  NumericVector x(n);
+  int_values x(n);
   
   bool throw_warning = false;
 
   for (int i = 0; i < n; i++)
-    x[i] = rng_dweibull(GETV(q, i), GETV(beta, i),
-                        throw_warning);
+    x.set(i, rng_dweibull(GETV(q, i), GETV(beta, i),
+                          throw_warning));
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
 
-  return x;
+  return x.result();
 }
 
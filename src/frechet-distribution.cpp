@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_families.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -30,7 +31,7 @@ using Rcpp::NumericVector;
  *
  */
 
-inline double pdf_frechet(double x, double lambda, double mu,
+double pdf_frechet(double x, double lambda, double mu,
                           double sigma, bool& throw_warning) {
   if (ISNAN(x) || ISNAN(lambda) || ISNAN(mu) || ISNAN(sigma))
     return x+lambda+mu+sigma;
@@ -44,7 +45,7 @@ inline double pdf_frechet(double x, double lambda, double mu,
   return lambda/sigma * pow(z, -1.0-lambda) * exp(-pow(z, -lambda));
 }
 
-inline double cdf_frechet(double x, double lambda, double mu,
+double cdf_frechet(double x, double lambda, double mu,
                           double sigma, bool& throw_warning) {
   if (ISNAN(x) || ISNAN(lambda) || ISNAN(mu) || ISNAN(sigma))
     return x+lambda+mu+sigma;
@@ -58,7 +59,7 @@ inline double cdf_frechet(double x, double lambda, double mu,
   return exp(pow(-z, -lambda));
 }
 
-inline double invcdf_frechet(double p, double lambda, double mu,
+double invcdf_frechet(double p, double lambda, double mu,
                              double sigma, bool& throw_warning) {
   if (ISNAN(p) || ISNAN(lambda) || ISNAN(mu) || ISNAN(sigma))
     return p+lambda+mu+sigma;
@@ -71,7 +72,7 @@ inline double invcdf_frechet(double p, double lambda, double mu,
   return mu + sigma * pow(-log(p), -1.0/lambda);
 }
 
-inline double rng_frechet(double lambda, double mu,
+double rng_frechet(double lambda, double mu,
                           double sigma, bool& throw_warning) {
   if (ISNAN(lambda) || ISNAN(mu) || ISNAN(sigma) ||
       lambda <= 0.0 || sigma <= 0.0) {
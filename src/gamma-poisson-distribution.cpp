@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_families.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -24,22 +25,22 @@ using Rcpp::NumericVector;
 *
 */
 
-inline double logpmf_gpois(double x, double alpha, double beta,
-                           bool& throw_warning) {
+double logpmf_gpois(double x, double alpha, double beta,
+                    bool& throw_warning, bool int_x) {
   if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta))
     return x+alpha+beta;
   if (alpha <= 0.0 || beta <= 0.0) {
     throw_warning = true;
     return NAN;
   }
-  if (!isInteger(x) || x < 0.0 || !R_FINITE(x))
+  if ((!int_x && !isInteger(x)) || x < 0.0 || !R_FINITE(x))
     return R_NegInf;
   double p = beta/(1.0+beta);
   return R::lgammafn(alpha+x) - (lfactorial(x) + R::lgammafn(alpha)) +
     log(p)*x + log(1.0-p)*alpha;
 }
 
-inline std::vector<double> cdf_gpois_table(double x, double alpha, double beta) {
+std::vector<double> cdf_gpois_table(double x, double alpha, double beta) {
   
   if (x < 0.0 || !R_FINITE(x) || alpha < 0.0 || beta < 0.0)
     Rcpp::stop("inadmissible values");
@@ -87,8 +88,8 @@ inline std::vector<double> cdf_gpois_table(double x, double alpha, double beta)
   return p_tab;
 }
 
-inline double rng_gpois(double alpha, double beta,
-                        bool& throw_warning) {
+double rng_gpois(double alpha, double beta,
+                 bool& throw_warning) {
   if (ISNAN(alpha) || ISNAN(beta) || alpha <= 0.0 || beta <= 0.0) {
     throw_warning = true;
     return NA_REAL;
@@ -98,12 +99,12 @@ inline double rng_gpois(double alpha, double beta,
 }
 
 
-// [[Rcpp::export]]
-NumericVector cpp_dgpois(
-    const NumericVector& x,
+template <typename T>
+inline NumericVector dgpois_values(
+    const T& x,
     const NumericVector& alpha,
     const NumericVector& beta,
-    const bool& log_prob = false
+    const bool& log_prob
   ) {
 
   int Nmax = std::max({
@@ -112,12 +113,13 @@ NumericVector cpp_dgpois(
     beta.length()
   });
   NumericVector p(Nmax);
+  const bool int_values = std::is_same<T, Rcpp::IntegerVector>::value;
   
   bool throw_warning = false;
 
   for (int i = 0; i < Nmax; i++)
-    p[i] = logpmf_gpois(GETV(x, i), GETV(alpha, i),
-                        GETV(beta, i), throw_warning);
+    p[i] = logpmf_gpois(as_dbl(GETV(x, i)), GETV(alpha, i),
+                        GETV(beta, i), throw_warning, int_values);
 
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -130,13 +132,27 @@ NumericVector cpp_dgpois(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_pgpois(
-    const NumericVector& x,
+NumericVector cpp_dgpois(
+    SEXP x,
     const NumericVector& alpha,
     const NumericVector& beta,
-    const bool& lower_tail = true,
     const bool& log_prob = false
   ) {
+  
+  if (TYPEOF(x) == INTSXP)
+    return dgpois_values(Rcpp::IntegerVector(x), alpha, beta, log_prob);
+  return dgpois_values(NumericVector(x), alpha, beta, log_prob);
+}
+
+
+template <typename T>
+inline NumericVector pgpois_values(
+    const T& x,
+    const NumericVector& alpha,
+    const NumericVector& beta,
+    const bool& lower_tail,
+    const bool& log_prob
+  ) {
 
   int Nmax = std::max({
     x.length(),
@@ -144,6 +160,7 @@ NumericVector cpp_pgpois(
     beta.length()
   });
   NumericVector p(Nmax);
+  double xi;
   
   bool throw_warning = false;
 
@@ -153,16 +170,17 @@ NumericVector cpp_pgpois(
   for (int i = 0; i < Nmax; i++) {
     if (i % 1000 == 0)
       Rcpp::checkUserInterrupt();
-    if (ISNAN(GETV(x, i)) || ISNAN(GETV(alpha, i)) || ISNAN(GETV(beta, i))) {
-      p[i] = GETV(x, i) + GETV(alpha, i) + GETV(beta, i);
+    xi = as_dbl(GETV(x, i));
+    if (ISNAN(xi) || ISNAN(GETV(alpha, i)) || ISNAN(GETV(beta, i))) {
+      p[i] = xi + GETV(alpha, i) + GETV(beta, i);
     } else if (GETV(alpha, i) <= 0.0 || GETV(beta, i) <= 0.0) {
       throw_warning = true;
       p[i] = NAN;
-    } else if (GETV(x, i) < 0.0) {
+    } else if (xi < 0.0) {
       p[i] = 0.0;
-    } else if (GETV(x, i) == R_PosInf) {
+    } else if (xi == R_PosInf) {
       p[i] = 1.0;
-    } else if (is_large_int(GETV(x, i))) {
+    } else if (is_large_int(xi)) {
       p[i] = NA_REAL;
       Rcpp::warning("NAs introduced by coercion to integer range");
     } else {
@@ -171,7 +189,7 @@ NumericVector cpp_pgpois(
       if (!tmp.size()) {
         tmp = cdf_gpois_table(mx, GETV(alpha, i), GETV(beta, i));
       }
-      p[i] = tmp[to_pos_int(GETV(x, i))];
+      p[i] = tmp[to_pos_int(xi)];
       
     }
   } 
@@ -190,23 +208,153 @@ NumericVector cpp_pgpois(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_rgpois(
+NumericVector cpp_pgpois(
+    SEXP x,
+    const NumericVector& alpha,
+    const NumericVector& beta,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (TYPEOF(x) == INTSXP)
+    return pgpois_values(Rcpp::IntegerVector(x), alpha, beta, lower_tail,
+                         log_prob);
+  return pgpois_values(NumericVector(x), alpha, beta, lower_tail, log_prob);
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_qgpois(
+    const NumericVector& p,
+    const NumericVector& alpha,
+    const NumericVector& beta,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  int Nmax = std::max({
+    p.length(),
+    alpha.length(),
+    beta.length()
+  });
+  NumericVector x(Nmax);
+  NumericVector pp = Rcpp::clone(p);
+  
+  bool throw_warning = false;
+  
+  std::map<std::tuple<int, int>, std::vector<double>> memo;
+  double a, b;
+  int j;
+  
+  if (log_prob)
+    pp = Rcpp::exp(pp);
+  
+  if (!lower_tail)
+    pp = 1.0 - pp;
+  
+  for (int i = 0; i < Nmax; i++) {
+    
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+    
+    a = GETV(alpha, i);
+    b = GETV(beta, i);
+    
+    if (ISNAN(GETV(pp, i)) || ISNAN(a) || ISNAN(b)) {
+      x[i] = GETV(pp, i) + a + b;
+    } else if (a <= 0.0 || b <= 0.0 || !VALID_PROB(GETV(pp, i))) {
+      throw_warning = true;
+      x[i] = NAN;
+    } else if (GETV(pp, i) == 0.0) {
+      x[i] = 0.0;
+    } else if (GETV(pp, i) == 1.0) {
+      x[i] = R_PosInf;
+    } else {
+      
+      std::vector<double>& tmp = memo[std::make_tuple(i % alpha.length(),
+                                                      i % beta.length())];
+      j = search_cdf_table(GETV(pp, i), tmp, [=](double k) {
+        return cdf_gpois_table(k, a, b);
+      }, QTABLE_MAX_X);
+      
+      // beyond the table use the negative binomial quantile function
+      x[i] = (j >= 0) ? to_dbl(j) :
+        R::qnbinom(GETV(pp, i), a, 1.0/(1.0+b), true, false);
+      
+    }
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return x;
+}
+
+
+// [[Rcpp::export]]
+SEXP cpp_rgpois(
     const int& n,
     const NumericVector& alpha,
     const NumericVector& beta
   ) {
 
-  NumericVector x(n);
+  int_values x(n);
   
   bool throw_warning = false;
-
-  for (int i = 0; i < n; i++)
-    x[i] = rng_gpois(GETV(alpha, i), GETV(beta, i),
-                     throw_warning);
+  
+  int Npar = std::max({
+    alpha.length(),
+    beta.length()
+  });
+  
+  if (to_dbl(n) / to_dbl(Npar) < RNG_TABLE_MIN_REUSE) {
+    
+    for (int i = 0; i < n; i++)
+      x.set(i, rng_gpois(GETV(alpha, i), GETV(beta, i),
+                         throw_warning));
+    
+  } else {
+    
+    // parameters are recycled, so sample by inverting cached cdf tables,
+    // the tail beyond RNG_TABLE_MAX_X is sampled by rejection
+    
+    std::map<std::tuple<int, int>, std::vector<double>> memo;
+    double a, b, u;
+    int j;
+    
+    for (int i = 0; i < n; i++) {
+      
+      a = GETV(alpha, i);
+      b = GETV(beta, i);
+      
+      if (ISNAN(a) || ISNAN(b) || a <= 0.0 || b <= 0.0) {
+        throw_warning = true;
+        x.set(i, NA_REAL);
+        continue;
+      }
+      
+      std::vector<double>& tmp = memo[std::make_tuple(i % alpha.length(),
+                                                      i % beta.length())];
+      j = search_cdf_table(rng_unif(), tmp, [=](double k) {
+        return cdf_gpois_table(k, a, b);
+      }, RNG_TABLE_MAX_X);
+      
+      if (j >= 0) {
+        x.set(i, to_dbl(j));
+      } else {
+        do {
+          u = rng_gpois(a, b, throw_warning);
+        } while (u <= RNG_TABLE_MAX_X);
+        x.set(i, u);
+      }
+      
+    }
+    
+  }
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
 
-  return x;
+  return x.result();
 }
 
@@ -1,5 +1,7 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_families.h"
+#include "shared_kernels.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -35,7 +37,7 @@ using Rcpp::NumericVector;
  *
  */
 
-inline double pdf_gev(double x, double mu, double sigma,
+double pdf_gev(double x, double mu, double sigma,
                       double xi, bool& throw_warning) {
   if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi))
     return x+mu+sigma+xi;
@@ -54,7 +56,7 @@ inline double pdf_gev(double x, double mu, double sigma,
   }
 }
 
-inline double cdf_gev(double x, double mu, double sigma,
+double cdf_gev(double x, double mu, double sigma,
                       double xi, bool& throw_warning) {
   if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi))
     return x+mu+sigma+xi;
@@ -73,7 +75,7 @@ inline double cdf_gev(double x, double mu, double sigma,
   }
 }
 
-inline double invcdf_gev(double p, double mu, double sigma,
+double invcdf_gev(double p, double mu, double sigma,
                          double xi, bool& throw_warning) {
   if (ISNAN(p) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi))
     return p+mu+sigma+xi;
@@ -89,7 +91,7 @@ inline double invcdf_gev(double p, double mu, double sigma,
     return mu - sigma * log(-log(p));
 }
 
-inline double rng_gev(double mu, double sigma, double xi,
+double rng_gev(double mu, double sigma, double xi,
                       bool& throw_warning) {
   if (ISNAN(mu) || ISNAN(sigma) || ISNAN(xi) || sigma <= 0.0) {
     Rcpp::warning("NAs produced");
@@ -102,6 +104,39 @@ inline double rng_gev(double mu, double sigma, double xi,
     return mu - sigma * log(-log(u));
 }
 
+// log-density and its derivatives with respect to mu, sigma, xi,
+// written to grad; outside of the support the derivatives are zero
+
+double score_gev(double x, double mu, double sigma, double xi,
+                 double* grad, bool& throw_warning) {
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi)) {
+    grad[0] = grad[1] = grad[2] = x+mu+sigma+xi;
+    return x+mu+sigma+xi;
+  }
+  if (sigma <= 0.0) {
+    throw_warning = true;
+    grad[0] = grad[1] = grad[2] = NAN;
+    return NAN;
+  }
+  double z = (x-mu)/sigma;
+  if (!R_FINITE(z) || 1.0+xi*z <= 0.0) {
+    grad[0] = grad[1] = grad[2] = 0.0;
+    return R_NegInf;
+  }
+  double t = 1.0+xi*z;
+  double lt = log1p(xi*z);
+  // s = (1+xi*z)^{-1/xi}, g = d log f / dz
+  double s = (xi != 0.0) ? exp(-lt/xi) : exp(-z);
+  double g = (s - xi - 1.0) / t;
+  grad[0] = -g/sigma;
+  grad[1] = -(1.0 + g*z)/sigma;
+  grad[2] = (1.0 - s) * z*z * log1p_diff_sq(xi*z) - z/t;
+  if (xi != 0.0)
+    return -log(sigma) - (1.0 + 1.0/xi)*lt - s;
+  else
+    return -log(sigma) - z - s;
+}
+
 
 // [[Rcpp::export]]
 NumericVector cpp_dgev(
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_kernels.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -95,6 +96,54 @@ inline double logpdf_gompertz(double x, double a, double b,
   return log(a) + (b*x - a/b * (exp(b*x) - 1.0));
 }
 
+// log-density and its derivatives with respect to a, b,
+// written to grad; outside of the support the derivatives are zero
+
+double score_gompertz(double x, double a, double b,
+                      double* grad, bool& throw_warning) {
+  if (ISNAN(x) || ISNAN(a) || ISNAN(b)) {
+    grad[0] = grad[1] = x+a+b;
+    return x+a+b;
+  }
+  if (a <= 0.0 || b <= 0.0) {
+    throw_warning = true;
+    grad[0] = grad[1] = NAN;
+    return NAN;
+  }
+  if (x < 0.0 || !R_FINITE(x)) {
+    grad[0] = grad[1] = 0.0;
+    return R_NegInf;
+  }
+  double em1 = expm1(b*x);
+  grad[0] = 1.0/a - em1/b;
+  grad[1] = x - a/(b*b) * (b*x*(em1 + 1.0) - em1);
+  return log(a) + (b*x - a/b * em1);
+}
+
+// log f(x) (status = 1), log(1-F(x)) (status = 0) or log F(x)
+// (status = 2), sharing the cumulative hazard a/b * (exp(bx)-1)
+
+double logcens_gompertz(double x, double status, double a, double b,
+                        bool& throw_warning) {
+  if (ISNAN(x) || ISNAN(status) || ISNAN(a) || ISNAN(b))
+    return x+status+a+b;
+  if (a <= 0.0 || b <= 0.0 || (status != 0.0 && status != 1.0 && status != 2.0)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0)
+    return (status == 0.0) ? 0.0 : R_NegInf;
+  if (!R_FINITE(x))
+    return (status == 2.0) ? 0.0 : R_NegInf;
+  double H = a/b * expm1(b*x);
+  if (status == 1.0)
+    return log(a) + b*x - H;
+  else if (status == 0.0)
+    return -H;
+  else
+    return log(-expm1(-H));
+}
+
 
 // [[Rcpp::export]]
 NumericVector cpp_dgompertz(
@@ -1,5 +1,7 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_families.h"
+#include "shared_kernels.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -35,7 +37,7 @@ using Rcpp::NumericVector;
 *
 */
 
-inline double pdf_gpd(double x, double mu, double sigma, double xi,
+double pdf_gpd(double x, double mu, double sigma, double xi,
                       bool& throw_warning) {
   if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi))
     return x+mu+sigma+xi;
@@ -45,19 +47,19 @@ inline double pdf_gpd(double x, double mu, double sigma, double xi,
   }
   double z = (x-mu)/sigma;
   if (xi != 0.0) {
-    if (x >= mu)
+    if (x >= mu && (xi > 0.0 || x <= (mu - sigma/xi)))
       return pow(1.0+xi*z, -(xi+1.0)/xi)/sigma;
     else
       return 0.0;
   } else {
-    if (x >= mu && x <= (mu - sigma/xi))
+    if (x >= mu)
       return exp(-z)/sigma;
     else
       return 0.0;
   }
 }
 
-inline double cdf_gpd(double x, double mu, double sigma, double xi,
+double cdf_gpd(double x, double mu, double sigma, double xi,
                       bool& throw_warning) {
   if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi))
     return x+mu+sigma+xi;
@@ -67,19 +69,21 @@ inline double cdf_gpd(double x, double mu, double sigma, double xi,
   }
   double z = (x-mu)/sigma;
   if (xi != 0.0) {
-    if (x >= mu)
-      return 1.0 - pow(1.0+xi*z, -1.0/xi);
-    else
+    if (x < mu)
       return 0.0;
+    else if (xi < 0.0 && x >= (mu - sigma/xi))
+      return 1.0;
+    else
+      return 1.0 - pow(1.0+xi*z, -1.0/xi);
   } else {
-    if (x >= mu && x <= (mu - sigma/xi))
+    if (x >= mu)
       return 1.0 - exp(-z);
     else
       return 0.0;
   }
 }
 
-inline double invcdf_gpd(double p, double mu, double sigma, double xi,
+double invcdf_gpd(double p, double mu, double sigma, double xi,
                          bool& throw_warning) {
   if (ISNAN(p) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi))
     return p+mu+sigma+xi;
@@ -93,7 +97,7 @@ inline double invcdf_gpd(double p, double mu, double sigma, double xi,
     return mu - sigma * log(1.0-p);
 }
 
-inline double rng_gpd(double mu, double sigma, double xi,
+double rng_gpd(double mu, double sigma, double xi,
                       bool& throw_warning) {
   if (ISNAN(mu) || ISNAN(sigma) || ISNAN(xi) || sigma <= 0.0) {
     throw_warning = true;
@@ -106,6 +110,37 @@ inline double rng_gpd(double mu, double sigma, double xi,
     return mu - sigma * log(u);
 }
 
+// log-density and its derivatives with respect to mu, sigma, xi,
+// written to grad; outside of the support the derivatives are zero
+
+double score_gpd(double x, double mu, double sigma, double xi,
+                 double* grad, bool& throw_warning) {
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi)) {
+    grad[0] = grad[1] = grad[2] = x+mu+sigma+xi;
+    return x+mu+sigma+xi;
+  }
+  if (sigma <= 0.0) {
+    throw_warning = true;
+    grad[0] = grad[1] = grad[2] = NAN;
+    return NAN;
+  }
+  double z = (x-mu)/sigma;
+  if (z < 0.0 || !R_FINITE(z) || 1.0+xi*z <= 0.0) {
+    grad[0] = grad[1] = grad[2] = 0.0;
+    return R_NegInf;
+  }
+  double t = 1.0+xi*z;
+  // g = d log f / dz
+  double g = -(xi + 1.0) / t;
+  grad[0] = -g/sigma;
+  grad[1] = -(1.0 + g*z)/sigma;
+  grad[2] = z*z * log1p_diff_sq(xi*z) - z/t;
+  if (xi != 0.0)
+    return -log(sigma) - (1.0 + 1.0/xi)*log1p(xi*z);
+  else
+    return -log(sigma) - z;
+}
+
 
 // [[Rcpp::export]]
 NumericVector cpp_dgpd(
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_families.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -29,7 +30,7 @@ using Rcpp::NumericVector;
  *
  */
 
-inline double pdf_gumbel(double x, double mu, double sigma,
+double pdf_gumbel(double x, double mu, double sigma,
                          bool& throw_warning) {
   if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma))
     return x+mu+sigma;
@@ -43,7 +44,7 @@ inline double pdf_gumbel(double x, double mu, double sigma,
   return exp(-(z+exp(-z)))/sigma;
 }
 
-inline double cdf_gumbel(double x, double mu, double sigma,
+double cdf_gumbel(double x, double mu, double sigma,
                          bool& throw_warning) {
   if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma))
     return x+mu+sigma;
@@ -55,7 +56,7 @@ inline double cdf_gumbel(double x, double mu, double sigma,
   return exp(-exp(-z));
 }
 
-inline double invcdf_gumbel(double p, double mu, double sigma,
+double invcdf_gumbel(double p, double mu, double sigma,
                             bool& throw_warning) {
   if (ISNAN(p) || ISNAN(mu) || ISNAN(sigma))
     return p+mu+sigma;
@@ -66,7 +67,7 @@ inline double invcdf_gumbel(double p, double mu, double sigma,
   return mu - sigma * log(-log(p));
 }
 
-inline double rng_gumbel(double mu, double sigma,
+double rng_gumbel(double mu, double sigma,
                          bool& throw_warning) {
   if (ISNAN(mu) || ISNAN(sigma) || sigma <= 0.0) {
     throw_warning = true;
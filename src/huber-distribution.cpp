@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_kernels.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -106,6 +107,59 @@ inline double rng_huber(double mu, double sigma, double c,
     return mu - x*sigma;
 }
 
+// log F(z) of the standardized distribution for z <= 0, lA = log(A)
+
+inline double huber_lcdf(double z, double c, double lA) {
+  if (z <= -c)
+    return pow(c, 2.0)/2.0 - log(c) + c*z - log(SQRT_2_PI) - lA;
+  return log(phi(c)/c + Phi(z) - Phi(-c)) - lA;
+}
+
+// log P(lo < X <= hi), sharing the normalizing constant between the
+// endpoints; the difference is taken in the tail the interval is in,
+// and narrow intervals are integrated numerically
+
+double logint_huber(double lo, double hi, double mu, double sigma,
+                    double c, bool& throw_warning) {
+  if (ISNAN(lo) || ISNAN(hi) || ISNAN(mu) || ISNAN(sigma) || ISNAN(c))
+    return lo+hi+mu+sigma+c;
+  if (sigma <= 0.0 || c <= 0.0 || lo > hi) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (lo == hi)
+    return R_NegInf;
+  
+  double zl = (lo - mu)/sigma;
+  double zh = (hi - mu)/sigma;
+  double lA = log(2.0*(phi(c)/c - Phi(-c) + 0.5));
+  
+  // integrated over x, since the width of the interval is exact in x
+  // but not after standardization; the density is not smooth at
+  // mu-c*sigma and mu+c*sigma, so the interval is split there
+  if ((zh - zl) * (std::max(abs(zl), abs(zh)) + 1.0) < 0.05) {
+    auto logpdf = [&](double x) {
+      double az = abs((x - mu)/sigma);
+      double rho = (az <= c) ? pow(az, 2.0)/2.0 : c*az - pow(c, 2.0)/2.0;
+      return -rho - log(SQRT_2_PI*sigma) - lA;
+    };
+    double lp = R_NegInf, from = lo;
+    for (double knot : { mu - c*sigma, mu + c*sigma }) {
+      if (knot > from && knot < hi) {
+        lp = log_add_exp(lp, log_integrate_narrow(from, knot, logpdf));
+        from = knot;
+      }
+    }
+    return log_add_exp(lp, log_integrate_narrow(from, hi, logpdf));
+  }
+  
+  if (zh <= 0.0)
+    return log_sub_exp(huber_lcdf(zh, c, lA), huber_lcdf(zl, c, lA));
+  if (zl >= 0.0)
+    return log_sub_exp(huber_lcdf(-zl, c, lA), huber_lcdf(-zh, c, lA));
+  return log1p(-exp(huber_lcdf(zl, c, lA)) - exp(huber_lcdf(-zh, c, lA)));
+}
+
 
 // [[Rcpp::export]]
 NumericVector cpp_dhuber(
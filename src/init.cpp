@@ -0,0 +1,14 @@
+#include <Rcpp.h>
+#include <R_ext/Rdynload.h>
+
+
+// registration of the ALTREP class of lazy random vectors,
+// defined in lazy-random-vectors.cpp
+
+void lazy_init(DllInfo* dll);
+
+
+extern "C" void R_init_extraDistr(DllInfo* dll) {
+  lazy_init(dll);
+}
+
@@ -0,0 +1,20 @@
+#include <Rcpp.h>
+// [[Rcpp::plugins(cpp11)]]
+
+#include <chrono>
+
+
+/*
+ *  Monotonic wall clock (in seconds) used for timing the calls of the
+ *  functions calling the compiled code when the instrumentation is enabled,
+ *  with better resolution than proc.time()
+ *
+ */
+
+
+// [[Rcpp::export]]
+double cpp_instrument_clock() {
+  std::chrono::duration<double> t =
+    std::chrono::steady_clock::now().time_since_epoch();
+  return t.count();
+}
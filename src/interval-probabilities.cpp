@@ -0,0 +1,89 @@
+#include <Rcpp.h>
+#include "shared.h"
+#include "shared_kernels.h"
+// [[Rcpp::plugins(cpp11)]]
+
+using Rcpp::NumericVector;
+
+
+/*
+ *  Probabilities of intervals
+ *
+ *  Values:
+ *  lo <= hi
+ *
+ *  Parameters:
+ *  list of vectors of parameters of the distribution
+ *
+ *  P(lo < X <= hi) = F(hi) - F(lo)
+ *
+ *  The kernels compute the probabilities in the log scale with the
+ *  parameter-dependent constants computed once for both endpoints. The
+ *  difference is taken between the lower tail probabilities below the
+ *  center of the distribution and between the upper tail probabilities
+ *  above it, and narrow intervals, where the difference would cancel
+ *  out, are integrated numerically.
+ *
+ *  The kernels are described by the structs in shared_kernels.h.
+ *
+ */
+
+
+struct interval_op {
+  const NumericVector& lo;
+  const NumericVector& hi;
+  const std::vector<NumericVector>& params;
+  bool log_prob;
+  template <typename I> NumericVector run() const {
+    
+    if (static_cast<int>(params.size()) != I::npar)
+      Rcpp::stop("wrong number of parameters");
+    
+    R_xlen_t Nmax = std::max(lo.length(), hi.length());
+    bool empty = lo.length() < 1 || hi.length() < 1;
+    for (int m = 0; m < I::npar; m++) {
+      empty = empty || params[m].length() < 1;
+      Nmax = std::max(Nmax, params[m].length());
+    }
+    if (empty)
+      return NumericVector(0);
+    
+    NumericVector p(Nmax);
+    double par[I::npar];
+    bool throw_warning = false;
+    
+    for (R_xlen_t i = 0; i < Nmax; i++) {
+      
+      if (i % 1000 == 0)
+        Rcpp::checkUserInterrupt();
+      
+      for (int m = 0; m < I::npar; m++)
+        par[m] = params[m][i % params[m].length()];
+      
+      p[i] = I::logint(GETV(lo, i), GETV(hi, i), par, throw_warning);
+    }
+    
+    if (!log_prob)
+      p = Rcpp::exp(p);
+    
+    if (throw_warning)
+      Rcpp::warning("NaNs produced");
+    
+    return p;
+  }
+};
+
+
+// [[Rcpp::export]]
+NumericVector cpp_pinterval(
+    const NumericVector& lo,
+    const NumericVector& hi,
+    const std::string& family,
+    const Rcpp::List& params,
+    const bool& log_prob = false
+  ) {
+  
+  std::vector<NumericVector> par_list = param_list(params);
+  
+  return dispatch_interval(family, interval_op{ lo, hi, par_list, log_prob });
+}
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_kernels.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -89,6 +90,32 @@ inline double logpdf_kumar(double x, double a, double b,
   return log(a) + log(b) + log(x)*(a-1.0) + log(1.0 - pow(x, a))*(b-1.0);
 }
 
+// log-density and its derivatives with respect to a, b,
+// written to grad; outside of the support the derivatives are zero
+
+double score_kumar(double x, double a, double b,
+                   double* grad, bool& throw_warning) {
+  if (ISNAN(x) || ISNAN(a) || ISNAN(b)) {
+    grad[0] = grad[1] = x+a+b;
+    return x+a+b;
+  }
+  if (a <= 0.0 || b <= 0.0) {
+    throw_warning = true;
+    grad[0] = grad[1] = NAN;
+    return NAN;
+  }
+  if (x <= 0.0 || x >= 1.0) {
+    grad[0] = grad[1] = 0.0;
+    return R_NegInf;
+  }
+  double lx = log(x);
+  double xa = exp(a*lx);
+  double l1m = log1p(-xa);
+  grad[0] = 1.0/a + lx - (b-1.0) * xa*lx / (1.0-xa);
+  grad[1] = 1.0/b + l1m;
+  return log(a) + log(b) + lx*(a-1.0) + l1m*(b-1.0);
+}
+
 
 // [[Rcpp::export]]
 NumericVector cpp_dkumar(
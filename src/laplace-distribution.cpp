@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_families.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -31,7 +32,7 @@ using Rcpp::NumericVector;
  *
  */
 
-inline double pdf_laplace(double x, double mu, double sigma,
+double pdf_laplace(double x, double mu, double sigma,
                           bool& throw_warning) {
   if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma))
     return x+mu+sigma;
@@ -43,7 +44,7 @@ inline double pdf_laplace(double x, double mu, double sigma,
   return exp(-z)/(2.0*sigma);
 }
 
-inline double cdf_laplace(double x, double mu, double sigma,
+double cdf_laplace(double x, double mu, double sigma,
                           bool& throw_warning) {
   if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma))
     return x+mu+sigma;
@@ -58,7 +59,7 @@ inline double cdf_laplace(double x, double mu, double sigma,
     return 1.0 - exp(-z)/2.0;
 }
 
-inline double invcdf_laplace(double p, double mu, double sigma,
+double invcdf_laplace(double p, double mu, double sigma,
                              bool& throw_warning) {
   if (ISNAN(p) || ISNAN(mu) || ISNAN(sigma))
     return p+mu+sigma;
@@ -72,7 +73,7 @@ inline double invcdf_laplace(double p, double mu, double sigma,
     return mu - sigma * log(2.0*(1.0-p));
 }
 
-inline double rng_laplace(double mu, double sigma, bool& throw_warning) {
+double rng_laplace(double mu, double sigma, bool& throw_warning) {
   if (ISNAN(mu) || ISNAN(sigma) || sigma <= 0.0) {
     throw_warning = true;
     return NA_REAL;
@@ -0,0 +1,359 @@
+#include <Rcpp.h>
+#include "shared.h"
+#include "shared_families.h"
+// [[Rcpp::plugins(cpp11)]]
+
+#include <Rversion.h>
+#include <R_ext/Rdynload.h>
+#include <stdint.h>
+#include <cstring>
+
+#if defined(R_VERSION) && R_VERSION >= R_Version(3, 5, 0)
+#define EDCPP_ALTREP
+// before R 3.6.0 the header was not prepared for C++
+#if R_VERSION < R_Version(3, 6, 0)
+#define class klass
+extern "C" {
+#include <R_ext/Altrep.h>
+}
+#undef class
+#else
+#include <R_ext/Altrep.h>
+#endif
+#endif
+
+using Rcpp::NumericVector;
+
+
+/*
+ *  Lazily generated random values from a given family
+ *
+ *  x[i] = G^-1(u(seed, i))
+ *
+ *  where u(seed, i) is a uniform value obtained by hashing the seed and
+ *  the index i (the splitmix64 generator), so every value depends only on
+ *  its index and any region of the vector can be regenerated. The vector
+ *  is an ALTREP object that stores only the parameters and the seed: the
+ *  values are generated in blocks of LAZY_BLOCK_SIZE when they are
+ *  accessed, and the whole vector is allocated only if R asks for the
+ *  pointer to its data.
+ *
+ *  For R < 3.5.0 the values are generated eagerly.
+ *
+ */
+
+
+static const R_xlen_t LAZY_BLOCK_SIZE = 4096;
+
+
+inline uint64_t splitmix64(uint64_t z) {
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+// uniform value in (0, 1) for the i-th element
+
+inline double lazy_unif(uint64_t seed, R_xlen_t i) {
+  uint64_t z = splitmix64(seed + 0x9E3779B97F4A7C15ULL * (static_cast<uint64_t>(i) + 1));
+  return (static_cast<double>(z >> 11) + 0.5) / 9007199254740992.0;
+}
+
+
+struct lazy_rvec;
+
+typedef void (*lazy_fill_fun)(const lazy_rvec& s, R_xlen_t start,
+                              R_xlen_t len, double* x);
+
+struct lazy_rvec {
+  R_xlen_t n;
+  uint64_t seed;
+  std::vector<std::vector<double>> params;
+  lazy_fill_fun fill;
+  // the last generated block, for element-wise access
+  std::vector<double> block;
+  R_xlen_t block_start;
+};
+
+
+// values start, ..., start+len-1
+
+template <typename F>
+void lazy_fill(const lazy_rvec& s, R_xlen_t start, R_xlen_t len, double* x) {
+  
+  double par[F::npar];
+  double nans_sum;
+  bool throw_warning = false;
+  
+  for (R_xlen_t i = start; i < start + len; i++) {
+  
+    nans_sum = 0.0;
+    for (int m = 0; m < F::npar; m++) {
+      par[m] = s.params[m][i % s.params[m].size()];
+      nans_sum += par[m];
+    }
+  
+    if (ISNAN(nans_sum) || !F::valid(par))
+      x[i - start] = NA_REAL;
+    else
+      x[i - start] = F::invcdf(lazy_unif(s.seed, i), par, throw_warning);
+  }
+}
+
+
+struct lazy_setup_op {
+  const std::vector<std::vector<double>>& params;
+  bool& valid;
+  template <typename F> lazy_fill_fun run() const {
+  
+    if (static_cast<int>(params.size()) != F::npar)
+      Rcpp::stop("wrong number of parameters");
+  
+    size_t Npar = 0;
+    for (int m = 0; m < F::npar; m++)
+      Npar = std::max(Npar, params[m].size());
+  
+    double par[F::npar];
+    valid = true;
+    for (size_t i = 0; i < Npar && valid; i++) {
+      for (int m = 0; m < F::npar; m++)
+        par[m] = params[m][i % params[m].size()];
+      valid = F::valid(par);
+    }
+  
+    return &lazy_fill<F>;
+  }
+};
+
+
+// state: list of the family, parameters, seed and length, the same
+// as used for serialization; valid is false if some of the parameters
+// are not valid
+
+inline lazy_rvec* lazy_setup(const Rcpp::List& state, bool& valid) {
+  
+  std::string family = Rcpp::as<std::string>(state[0]);
+  Rcpp::List params = state[1];
+  NumericVector seed = Rcpp::as<NumericVector>(state[2]);
+  double n = Rcpp::as<double>(state[3]);
+  
+  lazy_rvec* s = new lazy_rvec();
+  s->n = static_cast<R_xlen_t>(n);
+  int64_t hi = static_cast<int64_t>(seed[0]);
+  int64_t lo = (seed.length() > 1) ? static_cast<int64_t>(seed[1]) : 0;
+  s->seed = splitmix64((static_cast<uint64_t>(hi) << 32) ^ static_cast<uint64_t>(lo));
+  s->block_start = -1;
+  
+  bool empty = false;
+  for (int m = 0; m < params.size(); m++) {
+    NumericVector par = Rcpp::as<NumericVector>(params[m]);
+    s->params.push_back(std::vector<double>(par.begin(), par.end()));
+    empty = empty || par.length() < 1;
+  }
+  if (empty)
+    s->n = 0;
+  
+  try {
+    s->fill = dispatch_family(family, lazy_setup_op{ s->params, valid });
+  } catch (...) {
+    delete s;
+    throw;
+  }
+  
+  return s;
+}
+
+
+#ifdef EDCPP_ALTREP
+
+static R_altrep_class_t lazy_rvec_class;
+
+// The ALTREP methods are called from the C code of R, so C++ exceptions
+// must not leave them. lazy_try runs body and returns false if it threw,
+// the message is kept in lazy_error_msg, so that the methods can signal
+// the R error after the C++ objects were destroyed.
+
+static char lazy_error_msg[256];
+
+template <typename F>
+inline bool lazy_try(F body) {
+  try {
+    body();
+    return true;
+  } catch (std::exception& e) {
+    std::strncpy(lazy_error_msg, e.what(), sizeof(lazy_error_msg) - 1);
+  } catch (...) {
+    std::strncpy(lazy_error_msg, "c++ exception (unknown reason)",
+                 sizeof(lazy_error_msg) - 1);
+  }
+  lazy_error_msg[sizeof(lazy_error_msg) - 1] = '\0';
+  return false;
+}
+
+static void lazy_finalize(SEXP ptr) {
+  lazy_rvec* s = static_cast<lazy_rvec*>(R_ExternalPtrAddr(ptr));
+  delete s;
+  R_ClearExternalPtr(ptr);
+}
+
+static SEXP lazy_make(SEXP state, bool& valid) {
+  lazy_rvec* s = lazy_setup(Rcpp::List(state), valid);
+  SEXP ptr = PROTECT(R_MakeExternalPtr(s, R_NilValue, state));
+  R_RegisterCFinalizerEx(ptr, lazy_finalize, TRUE);
+  SEXP x = R_new_altrep(lazy_rvec_class, ptr, R_NilValue);
+  UNPROTECT(1);
+  return x;
+}
+
+static lazy_rvec* lazy_state(SEXP x) {
+  return static_cast<lazy_rvec*>(R_ExternalPtrAddr(R_altrep_data1(x)));
+}
+
+// data2 holds the values once they were materialized
+
+static R_xlen_t lazy_length(SEXP x) {
+  return lazy_state(x)->n;
+}
+
+static void* lazy_dataptr(SEXP x, Rboolean writeable) {
+  if (R_altrep_data2(x) == R_NilValue) {
+    lazy_rvec* s = lazy_state(x);
+    SEXP val = PROTECT(Rf_allocVector(REALSXP, s->n));
+    if (!lazy_try([&]() { s->fill(*s, 0, s->n, REAL(val)); })) {
+      UNPROTECT(1);
+      Rf_error("%s", lazy_error_msg);
+    }
+    R_set_altrep_data2(x, val);
+    UNPROTECT(1);
+  }
+  return REAL(R_altrep_data2(x));
+}
+
+static const void* lazy_dataptr_or_null(SEXP x) {
+  if (R_altrep_data2(x) == R_NilValue)
+    return NULL;
+  return REAL(R_altrep_data2(x));
+}
+
+// the block is invalidated before it is refilled, so a failed
+// fill does not leave it partially generated
+
+static double lazy_elt(SEXP x, R_xlen_t i) {
+  if (R_altrep_data2(x) != R_NilValue)
+    return REAL(R_altrep_data2(x))[i];
+  lazy_rvec* s = lazy_state(x);
+  if (s->block_start < 0 || i < s->block_start ||
+      i >= s->block_start + static_cast<R_xlen_t>(s->block.size())) {
+    s->block_start = -1;
+    if (!lazy_try([&]() {
+      R_xlen_t start = i - i % LAZY_BLOCK_SIZE;
+      s->block.resize(std::min(LAZY_BLOCK_SIZE, s->n - start));
+      s->fill(*s, start, s->block.size(), s->block.data());
+      s->block_start = start;
+    }))
+      Rf_error("%s", lazy_error_msg);
+  }
+  return s->block[i - s->block_start];
+}
+
+static R_xlen_t lazy_get_region(SEXP x, R_xlen_t i, R_xlen_t len, double* buf) {
+  lazy_rvec* s = lazy_state(x);
+  len = std::min(len, s->n - i);
+  if (R_altrep_data2(x) != R_NilValue)
+    std::copy(REAL(R_altrep_data2(x)) + i, REAL(R_altrep_data2(x)) + i + len, buf);
+  else if (!lazy_try([&]() { s->fill(*s, i, len, buf); }))
+    Rf_error("%s", lazy_error_msg);
+  return len;
+}
+
+// values that were materialized could have been modified, so they
+// are serialized and duplicated as regular vectors
+
+static SEXP lazy_serialized_state(SEXP x) {
+  if (R_altrep_data2(x) != R_NilValue)
+    return NULL;
+  return R_ExternalPtrProtected(R_altrep_data1(x));
+}
+
+static SEXP lazy_unserialize(SEXP cls, SEXP state) {
+  SEXP x = R_NilValue;
+  bool valid;
+  if (!lazy_try([&]() { x = lazy_make(state, valid); }))
+    Rf_error("%s", lazy_error_msg);
+  return x;
+}
+
+static SEXP lazy_duplicate(SEXP x, Rboolean deep) {
+  if (R_altrep_data2(x) != R_NilValue)
+    return NULL;
+  SEXP y = R_NilValue;
+  bool valid;
+  if (!lazy_try([&]() {
+    y = lazy_make(R_ExternalPtrProtected(R_altrep_data1(x)), valid);
+  }))
+    Rf_error("%s", lazy_error_msg);
+  return y;
+}
+
+static Rboolean lazy_inspect(SEXP x, int pre, int deep, int pvec,
+                             void (*inspect_subtree)(SEXP, int, int, int)) {
+  Rprintf("lazy random vector (len=%.0f, materialized=%s)\n",
+          static_cast<double>(lazy_state(x)->n),
+          R_altrep_data2(x) == R_NilValue ? "F" : "T");
+  return TRUE;
+}
+
+void lazy_init(DllInfo* dll) {
+  lazy_rvec_class = R_make_altreal_class("lazy_rvec", "extraDistr", dll);
+  R_set_altrep_Length_method(lazy_rvec_class, lazy_length);
+  R_set_altrep_Serialized_state_method(lazy_rvec_class, lazy_serialized_state);
+  R_set_altrep_Unserialize_method(lazy_rvec_class, lazy_unserialize);
+  R_set_altrep_Duplicate_method(lazy_rvec_class, lazy_duplicate);
+  R_set_altrep_Inspect_method(lazy_rvec_class, lazy_inspect);
+  R_set_altvec_Dataptr_method(lazy_rvec_class, lazy_dataptr);
+  R_set_altvec_Dataptr_or_null_method(lazy_rvec_class, lazy_dataptr_or_null);
+  R_set_altreal_Elt_method(lazy_rvec_class, lazy_elt);
+  R_set_altreal_Get_region_method(lazy_rvec_class, lazy_get_region);
+}
+
+#else
+
+void lazy_init(DllInfo* dll) { }
+
+#endif
+
+
+// [[Rcpp::export]]
+SEXP cpp_rlazy(
+    const double& n,
+    const std::string& family,
+    const Rcpp::List& params,
+    const NumericVector& seed
+  ) {
+  
+  if (ISNAN(n) || n < 0.0)
+    Rcpp::stop("invalid arguments");
+  if (seed.length() < 1 || !R_FINITE(seed[0]) ||
+      (seed.length() > 1 && !R_FINITE(seed[1])))
+    Rcpp::stop("invalid seed");
+  
+  Rcpp::List state = Rcpp::List::create(family, params, seed, n);
+  bool valid;
+  
+#ifdef EDCPP_ALTREP
+  SEXP x = PROTECT(lazy_make(state, valid));
+#else
+  lazy_rvec* s = lazy_setup(state, valid);
+  NumericVector x(s->n);
+  s->fill(*s, 0, s->n, x.begin());
+  delete s;
+#endif
+  
+  if (!valid)
+    Rcpp::warning("NAs produced");
+  
+#ifdef EDCPP_ALTREP
+  UNPROTECT(1);
+#endif
+  return x;
+}
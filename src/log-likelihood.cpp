@@ -0,0 +1,104 @@
+#include <Rcpp.h>
+#include "shared.h"
+#include "shared_families.h"
+// [[Rcpp::plugins(cpp11)]]
+
+using std::pow;
+using std::sqrt;
+using std::abs;
+using std::exp;
+using std::log;
+using std::floor;
+using std::ceil;
+using Rcpp::NumericVector;
+
+
+/*
+ *  Log-likelihood of a distribution from a given family
+ *
+ *  Parameters:
+ *  list of vectors of parameters of the family
+ *  w (weights of the observations, w >= 0)
+ *
+ *  l = sum(w[i] * log f(x[i]))
+ *
+ *  The log-densities are evaluated and summed (using compensated
+ *  summation) in a single pass, without storing them. Observations
+ *  with zero weights are skipped.
+ *
+ */
+
+
+struct loglik_op {
+  const NumericVector& x;
+  const std::vector<NumericVector>& params;
+  const NumericVector& w;
+  template <typename F> double run() const {
+  
+    if (static_cast<int>(params.size()) != F::npar)
+      Rcpp::stop("wrong number of parameters");
+  
+    // as sum(d(x, ..., log = TRUE)) for empty vectors
+    if (x.length() < 1 || w.length() < 1)
+      return 0.0;
+    R_xlen_t Nmax = std::max(x.length(), w.length());
+    for (int m = 0; m < F::npar; m++) {
+      if (params[m].length() < 1)
+        return 0.0;
+      Nmax = std::max(Nmax, params[m].length());
+    }
+  
+    double par[F::npar];
+    double xi, wi, lp, nans_sum;
+    bool throw_warning = false;
+    compensated_sum ll;
+  
+    for (R_xlen_t i = 0; i < Nmax; i++) {
+  
+      if (i % 1000 == 0)
+        Rcpp::checkUserInterrupt();
+  
+      xi = x[i % x.length()];
+      wi = w[i % w.length()];
+      nans_sum = xi + wi;
+      for (int m = 0; m < F::npar; m++) {
+        par[m] = params[m][i % params[m].length()];
+        nans_sum += par[m];
+      }
+  
+      if (ISNAN(nans_sum)) {
+        lp = nans_sum;
+      } else if (wi < 0.0 || !F::valid(par)) {
+        throw_warning = true;
+        lp = NAN;
+      } else if (wi == 0.0) {
+        continue;
+      } else if (F::discrete && !isInteger(xi)) {
+        lp = R_NegInf;
+      } else {
+        lp = wi * F::logpdf(xi, par, throw_warning);
+      }
+  
+      ll.add(lp);
+    }
+  
+    if (throw_warning)
+      Rcpp::warning("NaNs produced");
+  
+    return ll.value();
+  }
+};
+
+
+// [[Rcpp::export]]
+double cpp_llfamily(
+    const NumericVector& x,
+    const std::string& family,
+    const Rcpp::List& params,
+    const NumericVector& weights
+  ) {
+  
+  std::vector<NumericVector> par_list = param_list(params);
+  
+  return dispatch_family(family, loglik_op{ x, par_list, weights });
+}
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_families.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -27,98 +28,178 @@ using Rcpp::NumericVector;
 */
 
 
-double pdf_lgser(double x, double theta, bool& throw_warnin) {
+double pdf_lgser(double x, double theta, bool& throw_warning, bool int_x) {
   if (ISNAN(x) || ISNAN(theta))
     return x+theta;
   if (theta <= 0.0 || theta >= 1.0) {
-    throw_warnin = true;
+    throw_warning = true;
     return NAN;
   }
-  if (!isInteger(x) || x < 1.0)
+  if ((!int_x && !isInteger(x)) || x < 1.0)
     return 0.0;
-  double a = -1.0/log(1.0 - theta);
+  double a = -1.0/log1p(-theta);
   return a * pow(theta, x) / x;
 }
 
 
-double cdf_lgser(double x, double theta, bool& throw_warnin) {
-  if (ISNAN(x) || ISNAN(theta))
-    return x+theta;
-  if (theta <= 0.0 || theta >= 1.0) {
-    throw_warnin = true;
-    return NAN;
-  }
-  if (x < 1.0)
-    return 0.0;
-  if (!R_FINITE(x))
-    return 1.0;
-  if (is_large_int(x)) {
-    Rcpp::warning("NAs introduced by coercion to integer range");
-    return NA_REAL;
-  }
+// Cumulative probabilities for 0, ..., x computed with the recursion
+// f(k+1) = f(k) * theta * k/(k+1). The table is truncated as soon as
+// adding further terms does not change it numerically.
+
+std::vector<double> cdf_lgser_table(double x, double theta) {
+  
+  if (x < 0.0 || !R_FINITE(x) || theta <= 0.0 || theta >= 1.0)
+    Rcpp::stop("inadmissible values");
   
-  double a = -1.0/log(1.0 - theta);
-  double b = 0.0;
-  double dk;
   int ix = to_pos_int(x);
+  std::vector<double> p_tab;
+  double pk, dk;
+  
+  p_tab.push_back(0.0);
+  pk = -theta/log1p(-theta);
   
   for (int k = 1; k <= ix; k++) {
+    p_tab.push_back(p_tab[k-1] + pk);
+    if (p_tab[k] == p_tab[k-1])
+      break;
     dk = to_dbl(k);
-    b += pow(theta, dk) / dk;
+    pk *= theta * dk/(dk + 1.0);
   }
   
-  return a * b;
+  return p_tab;
 }
 
-double invcdf_lgser(double p, double theta, bool& throw_warnin) {
-  if (ISNAN(p) || ISNAN(theta))
-    return p+theta;
-  if (theta <= 0.0 || theta >= 1.0 || !VALID_PROB(p)) {
-    throw_warnin = true;
-    return NAN;
-  }
-  if (p == 0.0)
-    return 1.0;
-  if (p == 1.0)
-    return R_PosInf;
+// Exponential integral E1(z), z > 0, by power series for z <= 1
+// and by continued fraction (modified Lentz's method) otherwise
+
+inline double expint_e1(double z) {
   
-  double pk = -theta/log(1.0 - theta);
-  double k = 1.0;
+  double s, t, b, c, d, h, an, del;
   
-  while (p > pk) {
-    p -= pk;
-    pk *= theta * k/(k+1.0);
-    k += 1.0;
+  if (z <= 1.0) {
+    s = 0.0;
+    t = 1.0;
+    for (int n = 1; n < 100; n++) {
+      t *= -z / to_dbl(n);
+      del = -t / to_dbl(n);
+      s += del;
+      if (abs(del) < abs(s) * 1e-16)
+        break;
+    }
+    return -0.5772156649015328606 - log(z) + s;
   }
   
-  return k;
+  b = z + 1.0;
+  c = 1.0 / std::numeric_limits<double>::min();
+  d = 1.0 / b;
+  h = d;
+  for (int n = 1; n < 1000; n++) {
+    an = -to_dbl(n) * to_dbl(n);
+    b += 2.0;
+    d = 1.0 / (an * d + b);
+    c = b + an / c;
+    del = c * d;
+    h *= del;
+    if (abs(del - 1.0) < 1e-16)
+      break;
+  }
+  return h * exp(-z);
 }
 
-double rng_lgser(double theta, bool& throw_warnin) {
+// Tail sum of theta^j/j over j > k, for large k (beyond the cached
+// tables), by the Euler-Maclaurin formula with f(x) = exp(-lambda*x)/x,
+// lambda = -log(theta), where the integral of f is E1(lambda*(k+1))
+
+inline double tail_lgser(double k, double theta) {
+  double lambda = -log(theta);
+  double a = k + 1.0;
+  double fa = exp(-lambda * a) / a;
+  return expint_e1(lambda * a) + fa/2.0 + fa * (lambda + 1.0/a) / 12.0;
+}
+
+// F(k) and the quantile function for large k (beyond the cached tables),
+// the quantile is searched for above lo
+
+double cdf_lgser_tail(double k, double theta) {
+  return 1.0 - tail_lgser(k, theta) / -log1p(-theta);
+}
+
+// F(k) for a single value, by the same recursion as cdf_lgser_table
+// without storing the terms, and by cdf_lgser_tail beyond QTABLE_MAX_X
+
+inline double cdf_lgser(double k, double theta) {
+  if (k > QTABLE_MAX_X)
+    return cdf_lgser_tail(k, theta);
+  double p = 0.0, last, pk = -theta/log1p(-theta);
+  for (double j = 1.0; j <= k; j += 1.0) {
+    last = p;
+    p += pk;
+    if (p == last)
+      break;
+    pk *= theta * j/(j + 1.0);
+  }
+  return p;
+}
+
+double invcdf_lgser_tail(double p, double theta, double lo) {
+  double q = (1.0 - p) * -log1p(-theta);
+  double x = search_cdf_bracket([=](double k) {
+    return tail_lgser(k, theta) <= q;
+  }, lo, to_dbl(std::numeric_limits<int>::max()));
+  return (x < 0.0) ? R_PosInf : x;
+}
+
+// Kemp's (1981) algorithms: LS (sequential search starting at the mode)
+// for small theta and LK, with O(1) expected cost, for theta close to 1
+
+double rng_lgser(double theta, bool& throw_warning) {
   if (ISNAN(theta) || theta <= 0.0 || theta >= 1.0) {
-    throw_warnin = true;
+    throw_warning = true;
     return NA_REAL;
   }
-
-  double u = rng_unif();
-  double pk = -theta/log(1.0 - theta);
-  double k = 1.0;
   
-  while (u > pk) {
-    u -= pk;
-    pk *= theta * k/(k+1.0);
-    k += 1.0;
+  double u, v, q, pk, k;
+  
+  if (theta < 0.95) {
+    
+    u = rng_unif();
+    pk = -theta/log1p(-theta);
+    k = 1.0;
+    
+    while (u > pk) {
+      u -= pk;
+      pk *= theta * k/(k+1.0);
+      k += 1.0;
+    }
+    
+    if (sampler_diag.enabled())
+      sampler_diag.record("lgser: sequential search", k);
+    return k;
   }
   
-  return k;
+  // for Kemp's algorithm the number of used uniforms is recorded
+  v = rng_unif();
+  if (v >= theta) {
+    if (sampler_diag.enabled())
+      sampler_diag.record("lgser: Kemp's algorithm", 1.0);
+    return 1.0;
+  }
+  if (sampler_diag.enabled())
+    sampler_diag.record("lgser: Kemp's algorithm", 2.0);
+  u = rng_unif();
+  q = -expm1(u * log1p(-theta));
+  if (v <= q*q)
+    return floor(1.0 + log(v)/log(q));
+  if (v <= q)
+    return 2.0;
+  return 1.0;
 }
 
-
-// [[Rcpp::export]]
-NumericVector cpp_dlgser(
-    const NumericVector& x,
+template <typename T>
+inline NumericVector dlgser_values(
+    const T& x,
     const NumericVector& theta,
-    const bool& log_prob = false
+    const bool& log_prob
   ) {
 
   int Nmax = std::max({
@@ -126,12 +207,13 @@ NumericVector cpp_dlgser(
     theta.length()
   });
   NumericVector p(Nmax);
+  const bool int_values = std::is_same<T, Rcpp::IntegerVector>::value;
   
   bool throw_warning = false;
 
   for (int i = 0; i < Nmax; i++)
-    p[i] = pdf_lgser(GETV(x, i), GETV(theta, i),
-                     throw_warning);
+    p[i] = pdf_lgser(as_dbl(GETV(x, i)), GETV(theta, i),
+                     throw_warning, int_values);
  
  if (log_prob)
    p = Rcpp::log(p);
@@ -144,24 +226,77 @@ NumericVector cpp_dlgser(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_plgser(
-    const NumericVector& x,
+NumericVector cpp_dlgser(
+    SEXP x,
     const NumericVector& theta,
-    const bool& lower_tail = true,
     const bool& log_prob = false
   ) {
+  
+  if (TYPEOF(x) == INTSXP)
+    return dlgser_values(Rcpp::IntegerVector(x), theta, log_prob);
+  return dlgser_values(NumericVector(x), theta, log_prob);
+}
+
+
+template <typename T>
+inline NumericVector plgser_values(
+    const T& x,
+    const NumericVector& theta,
+    const bool& lower_tail,
+    const bool& log_prob
+  ) {
 
   int Nmax = std::max({
     x.length(),
     theta.length()
   });
   NumericVector p(Nmax);
+  double xi;
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
-    p[i] = cdf_lgser(GETV(x, i), GETV(theta, i),
-                     throw_warning);
+  // the tables are not grown beyond QTABLE_MAX_X, where the tail
+  // approximation is used, and they are used only if parameters are
+  // recycled, i.e. they are not longer in total than the number of
+  // computed probabilities, otherwise the probabilities are computed
+  // separately
+  
+  std::map<std::tuple<int>, std::vector<double>> memo;
+  double mx = std::min(finite_max_int(x), QTABLE_MAX_X);
+  bool use_table = to_dbl(theta.length()) * (mx + 1.0) <= to_dbl(Nmax);
+  double k;
+
+  for (int i = 0; i < Nmax; i++) {
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+    xi = as_dbl(GETV(x, i));
+    if (ISNAN(xi) || ISNAN(GETV(theta, i))) {
+      p[i] = xi + GETV(theta, i);
+    } else if (GETV(theta, i) <= 0.0 || GETV(theta, i) >= 1.0) {
+      throw_warning = true;
+      p[i] = NAN;
+    } else if (xi < 1.0) {
+      p[i] = 0.0;
+    } else if (xi == R_PosInf) {
+      p[i] = 1.0;
+    } else if (!use_table) {
+      p[i] = cdf_lgser(floor(xi), GETV(theta, i));
+    } else {
+      
+      std::vector<double>& tmp = memo[std::make_tuple(i % theta.length())];
+      if (!tmp.size()) {
+        tmp = cdf_lgser_table(mx, GETV(theta, i));
+      }
+      k = floor(xi);
+      if (k < to_dbl(tmp.size()))
+        p[i] = tmp[static_cast<int>(k)];
+      else if (to_dbl(tmp.size() - 1) < mx)  // the table converged
+        p[i] = tmp.back();
+      else
+        p[i] = cdf_lgser_tail(k, GETV(theta, i));
+      
+    }
+  }
 
   if (!lower_tail)
     p = 1.0 - p;
@@ -176,6 +311,20 @@ NumericVector cpp_plgser(
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_plgser(
+    SEXP x,
+    const NumericVector& theta,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (TYPEOF(x) == INTSXP)
+    return plgser_values(Rcpp::IntegerVector(x), theta, lower_tail, log_prob);
+  return plgser_values(NumericVector(x), theta, lower_tail, log_prob);
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_qlgser(
     const NumericVector& p,
@@ -199,9 +348,38 @@ NumericVector cpp_qlgser(
   if (!lower_tail)
     pp = 1.0 - pp;
   
-  for (int i = 0; i < Nmax; i++)
-    x[i] = invcdf_lgser(GETV(pp, i), GETV(theta, i),
-                        throw_warning);
+  std::map<std::tuple<int>, std::vector<double>> memo;
+  double t;
+  int j;
+  
+  for (int i = 0; i < Nmax; i++) {
+    
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+    
+    t = GETV(theta, i);
+    
+    if (ISNAN(GETV(pp, i)) || ISNAN(t)) {
+      x[i] = GETV(pp, i) + t;
+    } else if (t <= 0.0 || t >= 1.0 || !VALID_PROB(GETV(pp, i))) {
+      throw_warning = true;
+      x[i] = NAN;
+    } else if (GETV(pp, i) == 0.0) {
+      x[i] = 1.0;
+    } else if (GETV(pp, i) == 1.0) {
+      x[i] = R_PosInf;
+    } else {
+      
+      std::vector<double>& tmp = memo[std::make_tuple(i % theta.length())];
+      j = search_cdf_table(GETV(pp, i), tmp, [=](double k) {
+        return cdf_lgser_table(k, t);
+      }, QTABLE_MAX_X);
+      
+      x[i] = (j >= 0) ? to_dbl(j) :
+        invcdf_lgser_tail(GETV(pp, i), t, to_dbl(tmp.size() - 1));
+      
+    }
+  }
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -211,21 +389,21 @@ NumericVector cpp_qlgser(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_rlgser(
+SEXP cpp_rlgser(
     const int& n,
     const NumericVector& theta
   ) {
 
-  NumericVector x(n);
+  int_values x(n);
   
   bool throw_warning = false;
 
   for (int i = 0; i < n; i++)
-    x[i] = rng_lgser(GETV(theta, i), throw_warning);
+    x.set(i, rng_lgser(GETV(theta, i), throw_warning));
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
 
-  return x;
+  return x.result();
 }
 
@@ -1,5 +1,7 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_families.h"
+#include "shared_kernels.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -28,7 +30,7 @@ using Rcpp::NumericVector;
 *
 */
 
-inline double pdf_lomax(double x, double lambda, double kappa,
+double pdf_lomax(double x, double lambda, double kappa,
                         bool& throw_warning) {
   if (ISNAN(x) || ISNAN(lambda) || ISNAN(kappa))
     return x+lambda+kappa;
@@ -41,7 +43,7 @@ inline double pdf_lomax(double x, double lambda, double kappa,
   return lambda*kappa / pow(1.0+lambda*x, kappa+1.0);
 }
 
-inline double logpdf_lomax(double x, double lambda, double kappa,
+double logpdf_lomax(double x, double lambda, double kappa,
                            bool& throw_warning) {
   if (ISNAN(x) || ISNAN(lambda) || ISNAN(kappa))
     return x+lambda+kappa;
@@ -54,7 +56,7 @@ inline double logpdf_lomax(double x, double lambda, double kappa,
   return log(lambda) + log(kappa) - log(1.0+lambda*x)*(kappa+1.0);
 }
 
-inline double cdf_lomax(double x, double lambda, double kappa,
+double cdf_lomax(double x, double lambda, double kappa,
                         bool& throw_warning) {
   if (ISNAN(x) || ISNAN(lambda) || ISNAN(kappa))
     return x+lambda+kappa;
@@ -67,7 +69,7 @@ inline double cdf_lomax(double x, double lambda, double kappa,
   return 1.0 - pow(1.0+lambda*x, -kappa);
 }
 
-inline double invcdf_lomax(double p, double lambda, double kappa,
+double invcdf_lomax(double p, double lambda, double kappa,
                            bool& throw_warning) {
   if (ISNAN(p) || ISNAN(lambda) || ISNAN(kappa))
     return p+lambda+kappa;
@@ -78,7 +80,7 @@ inline double invcdf_lomax(double p, double lambda, double kappa,
   return (pow(1.0-p, -1.0/kappa)-1.0) / lambda;
 }
 
-inline double rng_lomax(double lambda, double kappa, bool& throw_warning) {
+double rng_lomax(double lambda, double kappa, bool& throw_warning) {
   if (ISNAN(lambda) || ISNAN(kappa) || lambda <= 0.0 || kappa <= 0.0) {
     throw_warning = true;
     return NA_REAL;
@@ -87,6 +89,54 @@ inline double rng_lomax(double lambda, double kappa, bool& throw_warning) {
   return (pow(u, -1.0/kappa)-1.0) / lambda;
 }
 
+// log-density and its derivatives with respect to lambda, kappa,
+// written to grad; outside of the support the derivatives are zero
+
+double score_lomax(double x, double lambda, double kappa,
+                   double* grad, bool& throw_warning) {
+  if (ISNAN(x) || ISNAN(lambda) || ISNAN(kappa)) {
+    grad[0] = grad[1] = x+lambda+kappa;
+    return x+lambda+kappa;
+  }
+  if (lambda <= 0.0 || kappa <= 0.0) {
+    throw_warning = true;
+    grad[0] = grad[1] = NAN;
+    return NAN;
+  }
+  if (x <= 0.0 || !R_FINITE(x)) {
+    grad[0] = grad[1] = 0.0;
+    return R_NegInf;
+  }
+  double lt = log1p(lambda*x);
+  grad[0] = 1.0/lambda - (kappa+1.0) * x/(1.0+lambda*x);
+  grad[1] = 1.0/kappa - lt;
+  return log(lambda) + log(kappa) - lt*(kappa+1.0);
+}
+
+// log f(x) (status = 1), log(1-F(x)) (status = 0) or log F(x)
+// (status = 2), sharing log(1+lambda*x)
+
+double logcens_lomax(double x, double status, double lambda, double kappa,
+                     bool& throw_warning) {
+  if (ISNAN(x) || ISNAN(status) || ISNAN(lambda) || ISNAN(kappa))
+    return x+status+lambda+kappa;
+  if (lambda <= 0.0 || kappa <= 0.0 || (status != 0.0 && status != 1.0 && status != 2.0)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x <= 0.0)
+    return (status == 0.0) ? 0.0 : R_NegInf;
+  if (!R_FINITE(x))
+    return (status == 2.0) ? 0.0 : R_NegInf;
+  double lt = log1p(lambda*x);
+  if (status == 1.0)
+    return log(lambda) + log(kappa) - lt*(kappa+1.0);
+  else if (status == 0.0)
+    return -kappa*lt;
+  else
+    return log(-expm1(-kappa*lt));
+}
+
 
 // [[Rcpp::export]]
 NumericVector cpp_dlomax(
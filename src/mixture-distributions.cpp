@@ -0,0 +1,140 @@
+#include <Rcpp.h>
+#include "shared.h"
+#include "shared_families.h"
+#include "shared_mixtures.h"
+// [[Rcpp::plugins(cpp11)]]
+
+using std::pow;
+using std::sqrt;
+using std::abs;
+using std::exp;
+using std::log;
+using std::floor;
+using std::ceil;
+using Rcpp::NumericVector;
+using Rcpp::NumericMatrix;
+
+
+/*
+ *  Mixtures of distributions from a given family
+ *
+ *  Parameters:
+ *  list of matrices of parameters of the components (rows correspond
+ *  to the values, columns to the components)
+ *  alpha (matrix of non-negative mixing proportions)
+ *
+ *  f(x) = sum_j alpha_j/sum(alpha) * f_j(x)
+ *  F(x) = sum_j alpha_j/sum(alpha) * F_j(x)
+ *
+ */
+
+
+inline std::vector<NumericMatrix> mix_param_list(const Rcpp::List& params) {
+  std::vector<NumericMatrix> out;
+  for (int m = 0; m < params.size(); m++)
+    out.push_back(Rcpp::as<NumericMatrix>(params[m]));
+  return out;
+}
+
+
+struct mix_pdf_op {
+  const NumericVector& x;
+  const std::vector<NumericMatrix>& params;
+  const NumericMatrix& alpha;
+  bool log_prob, responsibilities;
+  template <typename F> NumericVector run() const {
+    return mixture_pdf<F>(x, params, alpha, log_prob, responsibilities);
+  }
+};
+
+struct mix_cdf_op {
+  const NumericVector& x;
+  const std::vector<NumericMatrix>& params;
+  const NumericMatrix& alpha;
+  bool lower_tail, log_prob;
+  template <typename F> NumericVector run() const {
+    return mixture_cdf<F>(x, params, alpha, lower_tail, log_prob);
+  }
+};
+
+struct mix_invcdf_op {
+  const NumericVector& p;
+  const std::vector<NumericMatrix>& params;
+  const NumericMatrix& alpha;
+  bool lower_tail, log_prob;
+  template <typename F> NumericVector run() const {
+    return mixture_invcdf<F>(p, params, alpha, lower_tail, log_prob);
+  }
+};
+
+struct mix_rng_op {
+  int n;
+  const std::vector<NumericMatrix>& params;
+  const NumericMatrix& alpha;
+  template <typename F> NumericVector run() const {
+    return mixture_rng<F>(n, params, alpha);
+  }
+};
+
+
+// [[Rcpp::export]]
+NumericVector cpp_dmix(
+    const NumericVector& x,
+    const std::string& family,
+    const Rcpp::List& params,
+    const NumericMatrix& alpha,
+    const bool& log_prob = false,
+    const bool& responsibilities = false
+  ) {
+  
+  std::vector<NumericMatrix> par = mix_param_list(params);
+  mix_pdf_op op = { x, par, alpha, log_prob, responsibilities };
+  return dispatch_family(family, op);
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_pmix(
+    const NumericVector& x,
+    const std::string& family,
+    const Rcpp::List& params,
+    const NumericMatrix& alpha,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  std::vector<NumericMatrix> par = mix_param_list(params);
+  mix_cdf_op op = { x, par, alpha, lower_tail, log_prob };
+  return dispatch_family(family, op);
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_qmix(
+    const NumericVector& p,
+    const std::string& family,
+    const Rcpp::List& params,
+    const NumericMatrix& alpha,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  std::vector<NumericMatrix> par = mix_param_list(params);
+  mix_invcdf_op op = { p, par, alpha, lower_tail, log_prob };
+  return dispatch_family(family, op);
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_rmix(
+    const int& n,
+    const std::string& family,
+    const Rcpp::List& params,
+    const NumericMatrix& alpha
+  ) {
+  
+  std::vector<NumericMatrix> par = mix_param_list(params);
+  mix_rng_op op = { n, par, alpha };
+  return dispatch_family(family, op);
+}
+
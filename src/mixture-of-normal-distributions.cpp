@@ -1,5 +1,7 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_families.h"
+#include "shared_mixtures.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -19,7 +21,8 @@ NumericVector cpp_dmixnorm(
     const NumericMatrix& mu,
     const NumericMatrix& sigma,
     const NumericMatrix& alpha,
-    const bool& log_prob = false
+    const bool& log_prob = false,
+    const bool& responsibilities = false
   ) {
   
   int Nmax = std::max({
@@ -36,41 +39,45 @@ NumericVector cpp_dmixnorm(
   if (k != mu.ncol() || k != sigma.ncol())
     Rcpp::stop("sizes of mu, sigma, and alpha do not match");
   
-  bool wrong_param;
-  double alpha_tot, nans_sum;
-  
-  for (int i = 0; i < Nmax; i++) {
-    wrong_param = false;
-    alpha_tot = 0.0;
-    nans_sum = 0.0;
-    p[i] = 0.0;
-    
-    for (int j = 0; j < k; j++) {
-      if (GETM(alpha, i, j) < 0.0 || GETM(sigma, i, j) <= 0.0)
-        wrong_param = true;
-      nans_sum += GETM(mu, i, j) + GETM(sigma, i, j);
-      alpha_tot += GETM(alpha, i, j);
-    }
-    
-    if (ISNAN(nans_sum + alpha_tot + GETV(x, i))) {
-      p[i] = nans_sum + alpha_tot + GETV(x, i);
-      continue;
-    }
-    
-    if (wrong_param) {
-      throw_warning = true;
-      p[i] = NAN;
-      continue;
-    }
-    
-    for (int j = 0; j < k; j++) {
-      p[i] += (GETM(alpha, i, j) / alpha_tot) *
-        R::dnorm(GETV(x, i), GETM(mu, i, j), GETM(sigma, i, j), false);
-    }
-  }
-  
-  if (log_prob)
-    p = Rcpp::log(p);
+  if (x.length() < 1 || mu.nrow() < 1 || sigma.nrow() < 1 || alpha.nrow() < 1)
+    return NumericVector(0);
+  
+  NumericMatrix resp(responsibilities ? Nmax : 0, responsibilities ? k : 0);
+  
+  // parameters of the components are stored as mu_j, log(sigma_j)
+  // and 1/sigma_j, so the inner loop is simple arithmetic
+  
+  std::vector<double> mu_j(k), log_sigma_j(k), inv_sigma_j(k);
+  std::vector<int> nrows = { mu.nrow(), sigma.nrow(), alpha.nrow() };
+  double lconst = -log(SQRT_2_PI);
+  
+  mixture_logpdf(x, Nmax, alpha, nrows,
+    [&](int i, double& nans_sum) {
+      bool valid = true;
+      for (int j = 0; j < k; j++) {
+        if (GETM(sigma, i, j) <= 0.0)
+          valid = false;
+        nans_sum += GETM(mu, i, j) + GETM(sigma, i, j);
+        mu_j[j] = GETM(mu, i, j);
+        log_sigma_j[j] = log(GETM(sigma, i, j));
+        inv_sigma_j[j] = 1.0 / GETM(sigma, i, j);
+      }
+      return valid;
+    },
+    [](double xi) {
+      return true;
+    },
+    [&](double xi, int j) {
+      double z = (xi - mu_j[j]) * inv_sigma_j[j];
+      return lconst - log_sigma_j[j] - 0.5*z*z;
+    },
+    p, responsibilities ? resp.begin() : NULL, throw_warning);
+  
+  if (!log_prob)
+    p = Rcpp::exp(p);
+  
+  if (responsibilities)
+    p.attr("responsibilities") = resp;
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -89,65 +96,29 @@ NumericVector cpp_pmixnorm(
     const bool& log_prob = false
   ) {
   
-  int Nmax = std::max({
-    static_cast<int>(x.length()),
-    static_cast<int>(mu.nrow()),
-    static_cast<int>(sigma.nrow()),
-    static_cast<int>(alpha.nrow())
-  });
-  int k = alpha.ncol();
-  NumericVector p(Nmax);
-  
-  bool throw_warning = false;
-  
-  if (k != mu.ncol() || k != sigma.ncol())
+  if (alpha.ncol() != mu.ncol() || alpha.ncol() != sigma.ncol())
     Rcpp::stop("sizes of mu, sigma, and alpha do not match");
   
-  bool wrong_param;
-  double alpha_tot, nans_sum;
-  
-  for (int i = 0; i < Nmax; i++) {
-    wrong_param = false;
-    alpha_tot = 0.0;
-    nans_sum = 0.0;
-    p[i] = 0.0;
-    
-    for (int j = 0; j < k; j++) {
-      if (GETM(alpha, i, j) < 0.0 || GETM(sigma, i, j) < 0.0) {
-        wrong_param = true;
-        break;
-      }
-      nans_sum += GETM(mu, i, j) + GETM(sigma, i, j);
-      alpha_tot += GETM(alpha, i, j);
-    }
-    
-    if (ISNAN(nans_sum + alpha_tot + GETV(x, i))) {
-      p[i] = nans_sum + alpha_tot + GETV(x, i);
-      continue;
-    }
-    
-    if (wrong_param) {
-      throw_warning = true;
-      p[i] = NAN;
-      continue;
-    }
-    
-    for (int j = 0; j < k; j++) {
-      p[i] += (GETM(alpha, i, j) / alpha_tot) *
-        R::pnorm(GETV(x, i), GETM(mu, i, j), GETM(sigma, i, j), true, false);
-    }
-  }
-  
-  if (!lower_tail)
-    p = 1.0 - p;
-  
-  if (log_prob)
-    p = Rcpp::log(p);
+  return mixture_cdf<family_norm>(x, { mu, sigma }, alpha,
+                                  lower_tail, log_prob);
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_qmixnorm(
+    const NumericVector& p,
+    const NumericMatrix& mu,
+    const NumericMatrix& sigma,
+    const NumericMatrix& alpha,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
   
-  if (throw_warning)
-    Rcpp::warning("NaNs produced");
+  if (alpha.ncol() != mu.ncol() || alpha.ncol() != sigma.ncol())
+    Rcpp::stop("sizes of mu, sigma, and alpha do not match");
   
-  return p;
+  return mixture_invcdf<family_norm>(p, { mu, sigma }, alpha,
+                                     lower_tail, log_prob);
 }
 
 
@@ -159,56 +130,9 @@ NumericVector cpp_rmixnorm(
     const NumericMatrix& alpha
   ) {
   
-  int k = alpha.ncol();
-  NumericVector x(n);
-  
-  bool throw_warning = false;
-  
-  if (k != mu.ncol() || k != sigma.ncol())
+  if (alpha.ncol() != mu.ncol() || alpha.ncol() != sigma.ncol())
     Rcpp::stop("sizes of mu, sigma, and alpha do not match");
   
-  int jj;
-  bool wrong_param;
-  double alpha_tot, nans_sum, u, p_tmp;
-  NumericVector prob(k);
-  
-  for (int i = 0; i < n; i++) {
-    jj = 0;
-    wrong_param = false;
-    u = rng_unif();
-    p_tmp = 1.0;
-    alpha_tot = 0.0;
-    nans_sum = 0.0;
-    
-    for (int j = 0; j < k; j++) {
-      if (GETM(alpha, i, j) < 0.0 || GETM(sigma, i, j) < 0.0) {
-        wrong_param = true;
-        break;
-      }
-      nans_sum += GETM(mu, i, j) + GETM(sigma, i, j);
-      alpha_tot += GETM(alpha, i, j);
-    }
-    
-    if (ISNAN(nans_sum + alpha_tot) || wrong_param) {
-      throw_warning = true;
-      x[i] = NA_REAL;
-      continue;
-    }
-    
-    for (int j = k-1; j >= 0; j--) {
-      p_tmp -= GETM(alpha, i, j) / alpha_tot;
-      if (u > p_tmp) {
-        jj = j;
-        break;
-      }
-    }
-
-    x[i] = R::rnorm(GETM(mu, i, jj), GETM(sigma, i, jj)); 
-  }
-  
-  if (throw_warning)
-    Rcpp::warning("NAs produced");
-  
-  return x;
+  return mixture_rng<family_norm>(n, { mu, sigma }, alpha);
 }
 
@@ -1,5 +1,7 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_families.h"
+#include "shared_mixtures.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -13,12 +15,13 @@ using Rcpp::NumericVector;
 using Rcpp::NumericMatrix;
 
 
-// [[Rcpp::export]]
-NumericVector cpp_dmixpois(
-    const NumericVector& x,
+template <typename T>
+inline NumericVector dmixpois_values(
+    const T& x,
     const NumericMatrix& lambda,
     const NumericMatrix& alpha,
-    const bool& log_prob = false
+    bool log_prob,
+    bool responsibilities
   ) {
   
   int Nmax = std::max({
@@ -28,54 +31,45 @@ NumericVector cpp_dmixpois(
   });
   int k = alpha.ncol();
   NumericVector p(Nmax);
+  const bool int_values = std::is_same<T, Rcpp::IntegerVector>::value;
   
   bool throw_warning = false;
   
   if (k != lambda.ncol())
     Rcpp::stop("sizes of lambda and alpha do not match");
   
-  bool wrong_param;
-  double alpha_tot, nans_sum;
-  
-  for (int i = 0; i < Nmax; i++) {
-    wrong_param = false;
-    alpha_tot = 0.0;
-    nans_sum = 0.0;
-    p[i] = 0.0;
-    
-    for (int j = 0; j < k; j++) {
-      if (GETM(alpha, i, j) < 0.0 || GETM(lambda, i, j) < 0.0) {
-        wrong_param = true;
-        break;
+  if (x.length() < 1 || lambda.nrow() < 1 || alpha.nrow() < 1)
+    return NumericVector(0);
+  
+  NumericMatrix resp(responsibilities ? Nmax : 0, responsibilities ? k : 0);
+  
+  std::vector<double> lambda_j(k);
+  std::vector<int> nrows = { lambda.nrow(), alpha.nrow() };
+  
+  mixture_logpdf(x, Nmax, alpha, nrows,
+    [&](int i, double& nans_sum) {
+      bool valid = true;
+      for (int j = 0; j < k; j++) {
+        if (GETM(lambda, i, j) < 0.0)
+          valid = false;
+        nans_sum += GETM(lambda, i, j);
+        lambda_j[j] = GETM(lambda, i, j);
       }
-      nans_sum += GETM(lambda, i, j);
-      alpha_tot += GETM(alpha, i, j);
-    }
-    
-    if (ISNAN(nans_sum + alpha_tot + GETV(x, i))) {
-      p[i] = nans_sum + alpha_tot + GETV(x, i);
-      continue;
-    }
-    
-    if (wrong_param) {
-      throw_warning = true;
-      p[i] = NAN;
-      continue;
-    }
-    
-    if (GETV(x, i) < 0.0 || !isInteger(GETV(x, i))) {
-      p[i] = 0.0;
-      continue;
-    }
-    
-    for (int j = 0; j < k; j++) {
-      p[i] += (GETM(alpha, i, j) / alpha_tot) *
-        R::dpois(GETV(x, i), GETM(lambda, i, j), false);
-    }
-  }
-  
-  if (log_prob)
-    p = Rcpp::log(p);
+      return valid;
+    },
+    [&](double xi) {
+      return xi >= 0.0 && (int_values || isInteger(xi)) && R_FINITE(xi);
+    },
+    [&](double xi, int j) {
+      return R::dpois(xi, lambda_j[j], true);
+    },
+    p, responsibilities ? resp.begin() : NULL, throw_warning);
+  
+  if (!log_prob)
+    p = Rcpp::exp(p);
+  
+  if (responsibilities)
+    p.attr("responsibilities") = resp;
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -84,138 +78,62 @@ NumericVector cpp_dmixpois(
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_dmixpois(
+    SEXP x,
+    const NumericMatrix& lambda,
+    const NumericMatrix& alpha,
+    const bool& log_prob = false,
+    const bool& responsibilities = false
+  ) {
+  
+  if (TYPEOF(x) == INTSXP)
+    return dmixpois_values(Rcpp::IntegerVector(x), lambda, alpha,
+                           log_prob, responsibilities);
+  return dmixpois_values(NumericVector(x), lambda, alpha,
+                         log_prob, responsibilities);
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_pmixpois(
-    const NumericVector& x,
+    SEXP x,
     const NumericMatrix& lambda,
     const NumericMatrix& alpha,
     const bool& lower_tail = true,
     const bool& log_prob = false
   ) {
   
-  int Nmax = std::max({
-    static_cast<int>(x.length()),
-    static_cast<int>(lambda.nrow()),
-    static_cast<int>(alpha.nrow())
-  });
-  int k = alpha.ncol();
-  NumericVector p(Nmax);
-  
-  bool throw_warning = false;
-  
-  if (k != lambda.ncol())
+  if (alpha.ncol() != lambda.ncol())
     Rcpp::stop("sizes of lambda and alpha do not match");
   
-  bool wrong_param;
-  double alpha_tot, nans_sum;
-  
-  for (int i = 0; i < Nmax; i++) {
-    wrong_param = false;
-    alpha_tot = 0.0;
-    nans_sum = 0.0;
-    p[i] = 0.0;
-    
-    for (int j = 0; j < k; j++) {
-      if (GETM(alpha, i, j) < 0.0 || GETM(lambda, i, j) < 0.0) {
-        wrong_param = true;
-        break;
-      }
-      nans_sum += GETM(lambda, i, j);
-      alpha_tot += GETM(alpha, i, j);
-    }
-    
-    if (ISNAN(nans_sum + alpha_tot + GETV(x, i))) {
-      p[i] = nans_sum + alpha_tot + GETV(x, i);
-      continue;
-    }
-    
-    if (wrong_param) {
-      throw_warning = true;
-      p[i] = NAN;
-      continue;
-    }
-    
-    if (GETV(x, i) < 0.0) {
-      p[i] = 0.0;
-      continue;
-    }
-    
-    for (int j = 0; j < k; j++) {
-      p[i] += (GETM(alpha, i, j) / alpha_tot) *
-        R::ppois(GETV(x, i), GETM(lambda, i, j), true, false);
-    }
-  }
-  
-  if (!lower_tail)
-    p = 1.0 - p;
-  
-  if (log_prob)
-    p = Rcpp::log(p);
-  
-  if (throw_warning)
-    Rcpp::warning("NaNs produced");
-  
-  return p;
+  if (TYPEOF(x) == INTSXP)
+    return mixture_cdf<family_pois>(Rcpp::IntegerVector(x), { lambda }, alpha,
+                                    lower_tail, log_prob);
+  return mixture_cdf<family_pois>(NumericVector(x), { lambda }, alpha,
+                                  lower_tail, log_prob);
 }
 
 
 // [[Rcpp::export]]
-NumericVector cpp_rmixpois(
+SEXP cpp_rmixpois(
     const int& n,
     const NumericMatrix& lambda,
     const NumericMatrix& alpha
   ) {
   
-  int k = alpha.ncol();
-  NumericVector x(n);
-  
-  bool throw_warning = false;
-  
-  if (k != lambda.ncol())
+  if (alpha.ncol() != lambda.ncol())
     Rcpp::stop("sizes of lambda and alpha do not match");
   
-  int jj;
-  bool wrong_param;
-  double u, p_tmp, alpha_tot, nans_sum;
-  NumericVector prob(k);
-  
-  for (int i = 0; i < n; i++) {
-    jj = 0;
-    wrong_param = false;
-    u = rng_unif();
-    p_tmp = 1.0;
-    alpha_tot = 0.0;
-    nans_sum = 0.0;
-    
-    for (int j = 0; j < k; j++) {
-      if (GETM(alpha, i, j) < 0.0 || GETM(lambda, i, j) < 0.0) {
-        wrong_param = true;
-        break;
-      }
-      nans_sum += GETM(lambda, i, j);
-      alpha_tot += GETM(alpha, i, j);
-    }
-    
-    if (ISNAN(nans_sum + alpha_tot) || wrong_param) {
-      throw_warning = true;
-      x[i] = NA_REAL;
-      continue;
-    }
-    
-    for (int j = k-1; j >= 0; j--) {
-      p_tmp -= GETM(alpha, i, j) / alpha_tot;
-      if (u > p_tmp) {
-        jj = j;
-        break;
-      }
-    }
-    
-    x[i] = R::rpois(GETM(lambda, i, jj)); 
-  }
+  std::vector<NumericMatrix> params = { lambda };
   
-  if (throw_warning)
-    Rcpp::warning("NAs produced");
+  if (mix_empty(n, mix_nrows<family_pois>(params, alpha)))
+    return Rcpp::IntegerVector(0);
+  
+  int_values x(n);
+  mixture_rng_values<family_pois>(n, params, alpha,
+                                  [&](int i, double xi) { x.set(i, xi); });
   
-  return x;
+  return x.result();
 }
 
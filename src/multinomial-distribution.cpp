@@ -107,7 +107,7 @@ NumericVector cpp_dmnom(
 
 
 // [[Rcpp::export]]
-NumericMatrix cpp_rmnom(
+SEXP cpp_rmnom(
     const int& n,
     const NumericVector& size,
     const NumericMatrix& prob
@@ -115,9 +115,9 @@ NumericMatrix cpp_rmnom(
   
   int k = prob.ncol();
   bool wrong_values;
-  double p_tmp, size_left, sum_p, p_tot;
+  double p_tmp, size_left, sum_p, p_tot, u;
   
-  NumericMatrix x(n, k);
+  int_values x(n, k);
   
   bool throw_warning = false;
   
@@ -143,24 +143,25 @@ NumericMatrix cpp_rmnom(
         GETV(size, i) < 0.0 || !isInteger(GETV(size, i), false)) {
       throw_warning = true;
       for (int j = 0; j < k; j++)
-        x(i, j) = NA_REAL;
+        x.set(i, j, NA_REAL);
       continue;
     }
 
     for (int j = 0; j < k-1; j++) {
       p_tmp = GETM(prob, i, j)/p_tot;
-      x(i, j) = R::rbinom(size_left, p_tmp/sum_p);
-      size_left -= x(i, j);
+      u = R::rbinom(size_left, p_tmp/sum_p);
+      x.set(i, j, u);
+      size_left -= u;
       sum_p -= p_tmp;
     }
     
-    x(i, k-1) = size_left;
+    x.set(i, k-1, size_left);
     
   }
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
   
-  return x;
+  return x.result();
 }
 
@@ -108,18 +108,18 @@ NumericVector cpp_dmvhyper(
 
 
 // [[Rcpp::export]]
-NumericMatrix cpp_rmvhyper(
+SEXP cpp_rmvhyper(
     const int& nn,
     const NumericMatrix& n,
     const NumericVector& k
   ) {
   
   int m = n.ncol();
-  NumericMatrix x(nn, m);
+  int_values x(nn, m);
   std::vector<double> n_otr(m);
   
   bool wrong_values;
-  double k_left;
+  double k_left, u;
   
   bool throw_warning = false;
 
@@ -143,7 +143,7 @@ NumericMatrix cpp_rmvhyper(
         !isInteger(GETV(k, i), false) || GETV(k, i) < 0.0) {
       throw_warning = true;
       for (int j = 0; j < m; j++)
-        x(i, j) = NA_REAL;
+        x.set(i, j, NA_REAL);
       continue;
     }
     
@@ -151,23 +151,25 @@ NumericMatrix cpp_rmvhyper(
       n_otr[j] = n_otr[j-1] - GETM(n, i, j);
     
     k_left = GETV(k, i);
-    x(i, 0) = R::rhyper(GETM(n, i, 0), n_otr[0], k_left);
-    k_left -= x(i, 0);
+    u = R::rhyper(GETM(n, i, 0), n_otr[0], k_left);
+    x.set(i, 0, u);
+    k_left -= u;
     
     if (m > 2) {
       for (int j = 1; j < m-1; j++) {
-        x(i, j) = R::rhyper(GETM(n, i, j), n_otr[j], k_left);
-        k_left -= x(i, j);
+        u = R::rhyper(GETM(n, i, j), n_otr[j], k_left);
+        x.set(i, j, u);
+        k_left -= u;
       }
     }
     
-    x(i, m-1) = k_left;
+    x.set(i, m-1, k_left);
     
   }
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
 
-  return x;
+  return x.result();
 }
 
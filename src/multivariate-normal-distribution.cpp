@@ -0,0 +1,309 @@
+#include <Rcpp.h>
+#include "shared.h"
+// [[Rcpp::plugins(cpp11)]]
+
+using std::pow;
+using std::sqrt;
+using std::abs;
+using std::exp;
+using std::log;
+using std::floor;
+using std::ceil;
+using Rcpp::NumericVector;
+using Rcpp::NumericMatrix;
+
+
+/*
+ *  Multivariate Normal distribution
+ *
+ *  Values:
+ *  x (k-dimensional)
+ *
+ *  Parameters:
+ *  mu (k-dimensional)
+ *  Sigma (k x k symmetric positive definite)
+ *
+ *  f(x) = (2*pi)^(-k/2) * det(Sigma)^(-1/2) *
+ *         exp(-1/2 * (x-mu)' Sigma^-1 (x-mu))
+ *
+ *  With Sigma = L L' (Cholesky decomposition), z = L^-1 (x-mu) is
+ *  standard normal and log(det(Sigma)) = 2 * sum(log(diag(L))).
+ *
+ */
+
+
+// number of rows processed together
+static const int MVN_BLOCK = 64;
+
+
+// Cholesky decomposition of the m-th k x k matrix stored column-wise in
+// sigma; the lower triangular factor L is stored column-wise in chol.
+// Returns false if the matrix is not symmetric positive definite
+// (or contains NAs).
+
+inline bool chol_mvnorm(const NumericVector& sigma, int m, int k,
+                        std::vector<double>& chol, double& half_logdet) {
+  
+  int off = m*k*k;
+  double s;
+  
+  chol.assign(k*k, 0.0);
+  half_logdet = 0.0;
+  
+  for (int j = 0; j < k; j++) {
+    for (int i = j; i < k; i++) {
+      if (ISNAN(sigma[off + j*k + i]) ||
+          !tol_equal(sigma[off + j*k + i], sigma[off + i*k + j]))
+        return false;
+    }
+  }
+  
+  for (int j = 0; j < k; j++) {
+    s = sigma[off + j*k + j];
+    for (int l = 0; l < j; l++)
+      s -= chol[l*k + j] * chol[l*k + j];
+    if (s <= 0.0)
+      return false;
+    chol[j*k + j] = sqrt(s);
+    half_logdet += log(chol[j*k + j]);
+    for (int i = j+1; i < k; i++) {
+      s = sigma[off + j*k + i];
+      for (int l = 0; l < j; l++)
+        s -= chol[l*k + i] * chol[l*k + j];
+      chol[j*k + i] = s / chol[j*k + j];
+    }
+  }
+  
+  return true;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_dmvnorm(
+    const NumericMatrix& x,
+    const NumericMatrix& mu,
+    const NumericVector& sigma,
+    const bool& log_prob = false
+  ) {
+  
+  int k = x.ncol();
+  
+  if (k < 1)
+    Rcpp::stop("x should have at least one column");
+  if (mu.ncol() != k)
+    Rcpp::stop("number of columns in x does not equal number of columns in mean");
+  if (sigma.length() < k*k || sigma.length() % (k*k) != 0)
+    Rcpp::stop("sigma should be a k x k matrix, or k x k x m array, where k = ncol(x)");
+  
+  int Nsig = sigma.length() / (k*k);
+  int Nmax = std::max({
+    x.nrow(),
+    mu.nrow(),
+    Nsig
+  });
+  NumericVector p(Nmax);
+  
+  if (x.nrow() == 0 || mu.nrow() == 0)
+    return NumericVector(0);
+  
+  bool throw_warning = false;
+  
+  // rows sharing the same covariance matrix are processed in blocks:
+  // z holds the block of (x-mu) column-wise and is transformed in place
+  // to L^-1 (x-mu) by forward substitution, with the innermost loop
+  // running over the rows of the block
+  
+  std::vector<double> chol;
+  std::vector<double> z(MVN_BLOCK * k);
+  std::vector<int> rows(MVN_BLOCK);
+  std::vector<bool> skip(MVN_BLOCK);
+  double half_logdet, sum, sig_sum, lconst = -0.5 * to_dbl(k) * log(2.0*M_PI);
+  bool valid;
+  int nb, i;
+  
+  for (int m = 0; m < Nsig && m < Nmax; m++) {
+  
+    Rcpp::checkUserInterrupt();
+  
+    valid = chol_mvnorm(sigma, m, k, chol, half_logdet);
+    
+    sig_sum = 0.0;
+    for (int j = 0; j < k*k; j++)
+      sig_sum += sigma[m*k*k + j];
+    
+    for (int start = m; start < Nmax; start += MVN_BLOCK * Nsig) {
+  
+      nb = 0;
+      for (i = start; i < Nmax && nb < MVN_BLOCK; i += Nsig)
+        rows[nb++] = i;
+  
+      for (int b = 0; b < nb; b++) {
+  
+        i = rows[b];
+        sum = 0.0;
+        skip[b] = false;
+  
+        for (int j = 0; j < k; j++) {
+          z[j*MVN_BLOCK + b] = GETM(x, i, j) - GETM(mu, i, j);
+          sum += z[j*MVN_BLOCK + b];
+        }
+  
+        if (ISNAN(sum + sig_sum)) {
+          p[i] = sum + sig_sum;
+          skip[b] = true;
+        } else if (!valid) {
+          throw_warning = true;
+          p[i] = NAN;
+          skip[b] = true;
+        } else if (!R_FINITE(sum)) {
+          p[i] = R_NegInf;
+          skip[b] = true;
+        }
+  
+        if (skip[b]) {
+          for (int j = 0; j < k; j++)
+            z[j*MVN_BLOCK + b] = 0.0;
+        }
+      }
+  
+      if (!valid)
+        continue;
+  
+      for (int j = 0; j < k; j++) {
+        for (int l = 0; l < j; l++) {
+          for (int b = 0; b < nb; b++)
+            z[j*MVN_BLOCK + b] -= chol[l*k + j] * z[l*MVN_BLOCK + b];
+        }
+        for (int b = 0; b < nb; b++)
+          z[j*MVN_BLOCK + b] /= chol[j*k + j];
+      }
+  
+      for (int b = 0; b < nb; b++) {
+        if (skip[b])
+          continue;
+        sum = 0.0;
+        for (int j = 0; j < k; j++)
+          sum += z[j*MVN_BLOCK + b] * z[j*MVN_BLOCK + b];
+        p[rows[b]] = lconst - half_logdet - 0.5*sum;
+      }
+    }
+  }
+  
+  if (!log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// [[Rcpp::export]]
+NumericMatrix cpp_rmvnorm(
+    const int& n,
+    const NumericMatrix& mu,
+    const NumericVector& sigma
+  ) {
+  
+  int k = mu.ncol();
+  NumericMatrix x(n, k);
+  
+  if (k < 1)
+    Rcpp::stop("mean should have at least one element");
+  if (sigma.length() < k*k || sigma.length() % (k*k) != 0)
+    Rcpp::stop("sigma should be a k x k matrix, or k x k x m array, where k = length(mean)");
+  
+  int Nsig = sigma.length() / (k*k);
+  
+  if (mu.nrow() == 0)
+    Rcpp::stop("mean should have at least one row");
+  
+  bool throw_warning = false;
+  
+  // Cholesky factors of the covariance matrices are computed once
+  
+  int Nchol = std::min(Nsig, n);
+  std::vector<double> chol, chols(Nchol * k*k);
+  std::vector<bool> valid(Nchol);
+  double half_logdet;
+  
+  for (int m = 0; m < Nchol; m++) {
+    valid[m] = chol_mvnorm(sigma, m, k, chol, half_logdet);
+    if (valid[m])
+      std::copy(chol.begin(), chol.end(), chols.begin() + m*k*k);
+  }
+  
+  // blocks of consecutive rows: the standard normal deviates z are drawn
+  // in row order, k per row also for rows with invalid parameters, so
+  // that every row gets the same values whatever n is and whatever the
+  // other rows are; they are transformed to mu + L z by columns, for the
+  // rows of the block sharing the covariance matrix at once
+  
+  std::vector<double> z(MVN_BLOCK * k);
+  std::vector<double> acc(MVN_BLOCK);
+  std::vector<int> rows(MVN_BLOCK);
+  const double* L;
+  bool wrong_mu;
+  int nb, nr, m;
+  
+  for (int start = 0; start < n; start += MVN_BLOCK) {
+  
+    Rcpp::checkUserInterrupt();
+  
+    nb = std::min(MVN_BLOCK, n - start);
+  
+    for (int b = 0; b < nb; b++) {
+      for (int j = 0; j < k; j++)
+        z[j*MVN_BLOCK + b] = R::norm_rand();
+    }
+  
+    for (int c = 0; c < nb && c < Nsig; c++) {
+  
+      m = (start + c) % Nsig;
+      nr = 0;
+      for (int b = c; b < nb; b += Nsig)
+        rows[nr++] = b;
+  
+      if (!valid[m]) {
+        throw_warning = true;
+        for (int r = 0; r < nr; r++) {
+          for (int j = 0; j < k; j++)
+            x(start + rows[r], j) = NA_REAL;
+        }
+        continue;
+      }
+  
+      L = &chols[m*k*k];
+      for (int j = 0; j < k; j++) {
+        for (int r = 0; r < nr; r++)
+          acc[r] = 0.0;
+        for (int l = 0; l <= j; l++) {
+          for (int r = 0; r < nr; r++)
+            acc[r] += L[l*k + j] * z[l*MVN_BLOCK + rows[r]];
+        }
+        for (int r = 0; r < nr; r++)
+          x(start + rows[r], j) = GETM(mu, start + rows[r], j) + acc[r];
+      }
+    }
+  
+    for (int b = 0; b < nb; b++) {
+      wrong_mu = false;
+      for (int j = 0; j < k; j++) {
+        if (!R_FINITE(GETM(mu, start + b, j)))
+          wrong_mu = true;
+      }
+      if (wrong_mu) {
+        throw_warning = true;
+        for (int j = 0; j < k; j++)
+          x(start + b, j) = NA_REAL;
+      }
+    }
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NAs produced");
+  
+  return x;
+}
+
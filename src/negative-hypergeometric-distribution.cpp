@@ -50,13 +50,57 @@ std::vector<double> nhyper_table(
 }
 
 
-// [[Rcpp::export]]
-NumericVector cpp_dnhyper(
-    const NumericVector& x,
+/*
+ *  Random generation by bisection of the urn: X is the position of the
+ *  r-th white ball among the m white and n black balls in random order.
+ *  The number of white balls among the first half of the positions is
+ *  drawn from the hypergeometric distribution; if it is at least r, the
+ *  r-th white ball is in the first half, otherwise it is in the second
+ *  half, and the search continues in that half. This needs
+ *  O(log(n+m)) hypergeometric draws and no tables.
+ */
+
+inline double rng_nhyper(double n, double m, double r,
+                         bool& throw_warning) {
+  if (ISNAN(n) || ISNAN(m) || ISNAN(r) || r > m || n < 0.0 ||
+      m < 0.0 || r < 0.0 || !isInteger(n, false) ||
+      !isInteger(m, false) || !isInteger(r, false)) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  if (r == 0.0)
+    return 0.0;
+  
+  double offset = 0.0;
+  double half, k, iter = 0.0;
+  
+  for (; m + n > 1.0; iter++) {
+    half = floor((m + n) / 2.0);
+    k = R::rhyper(m, n, half);
+    if (k >= r) {
+      n = half - k;
+      m = k;
+    } else {
+      offset += half;
+      r -= k;
+      m -= k;
+      n -= half - k;
+    }
+  }
+  
+  if (sampler_diag.enabled())
+    sampler_diag.record("nhyper: bisection", iter);
+  return offset + 1.0;
+}
+
+
+template <typename T>
+inline NumericVector dnhyper_values(
+    const T& x,
     const NumericVector& n,
     const NumericVector& m,
     const NumericVector& r,
-    const bool& log_prob = false
+    const bool& log_prob
   ) {
   
   int Nmax = std::max({
@@ -66,6 +110,8 @@ NumericVector cpp_dnhyper(
     r.length()
   });
   NumericVector p(Nmax);
+  double xi;
+  const bool int_values = std::is_same<T, Rcpp::IntegerVector>::value;
   
   bool throw_warning = false;
   
@@ -75,9 +121,11 @@ NumericVector cpp_dnhyper(
     if (i % 1000 == 0)
       Rcpp::checkUserInterrupt();
     
-    if (ISNAN(GETV(x, i)) || ISNAN(GETV(n, i)) ||
+    xi = as_dbl(GETV(x, i));
+    
+    if (ISNAN(xi) || ISNAN(GETV(n, i)) ||
         ISNAN(GETV(m, i)) || ISNAN(GETV(r, i))) {
-      p[i] = GETV(x, i) + GETV(n, i) + GETV(m, i) + GETV(r, i);
+      p[i] = xi + GETV(n, i) + GETV(m, i) + GETV(r, i);
     } else if (GETV(r, i) > GETV(m, i) || GETV(n, i) < 0.0 ||
                GETV(m, i) < 0.0 || GETV(r, i) < 0.0 ||
                !isInteger(GETV(n, i), false) ||
@@ -85,10 +133,10 @@ NumericVector cpp_dnhyper(
                !isInteger(GETV(r, i), false)) {
       throw_warning = true;
       p[i] = NAN;
-    } else if (!isInteger(GETV(x, i)) || GETV(x, i) < GETV(r, i) ||
-               GETV(x, i) > (GETV(n, i) + GETV(r, i))) {
+    } else if ((!int_values && !isInteger(xi)) || xi < GETV(r, i) ||
+               xi > (GETV(n, i) + GETV(r, i))) {
       p[i] = 0.0;
-    } else if (is_large_int(GETV(x, i))) {
+    } else if (is_large_int(xi)) {
       p[i] = NA_REAL;
       Rcpp::warning("NAs introduced by coercion to integer range");
     } else {
@@ -99,7 +147,7 @@ NumericVector cpp_dnhyper(
       if (!tmp.size()) {
         tmp = nhyper_table(GETV(n, i), GETV(m, i), GETV(r, i), false);
       }
-      p[i] = tmp[to_pos_int( GETV(x, i) - GETV(r, i) )];
+      p[i] = tmp[to_pos_int( xi - GETV(r, i) )];
       
     }
   } 
@@ -115,15 +163,30 @@ NumericVector cpp_dnhyper(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_pnhyper(
-    const NumericVector& x,
+NumericVector cpp_dnhyper(
+    SEXP x,
     const NumericVector& n,
     const NumericVector& m,
     const NumericVector& r,
-    const bool& lower_tail = true,
     const bool& log_prob = false
   ) {
   
+  if (TYPEOF(x) == INTSXP)
+    return dnhyper_values(Rcpp::IntegerVector(x), n, m, r, log_prob);
+  return dnhyper_values(NumericVector(x), n, m, r, log_prob);
+}
+
+
+template <typename T>
+inline NumericVector pnhyper_values(
+    const T& x,
+    const NumericVector& n,
+    const NumericVector& m,
+    const NumericVector& r,
+    const bool& lower_tail,
+    const bool& log_prob
+  ) {
+  
   int Nmax = std::max({
     x.length(),
     n.length(),
@@ -131,6 +194,7 @@ NumericVector cpp_pnhyper(
     r.length()
   });
   NumericVector p(Nmax);
+  double xi;
   
   bool throw_warning = false;
   
@@ -140,9 +204,11 @@ NumericVector cpp_pnhyper(
     if (i % 1000 == 0)
       Rcpp::checkUserInterrupt();
     
-    if (ISNAN(GETV(x, i)) || ISNAN(GETV(n, i)) ||
+    xi = as_dbl(GETV(x, i));
+    
+    if (ISNAN(xi) || ISNAN(GETV(n, i)) ||
         ISNAN(GETV(m, i)) || ISNAN(GETV(r, i))) {
-      p[i] = GETV(x, i) + GETV(n, i) + GETV(m, i) + GETV(r, i);
+      p[i] = xi + GETV(n, i) + GETV(m, i) + GETV(r, i);
     } else if (GETV(r, i) > GETV(m, i) || GETV(n, i) < 0.0 ||
                GETV(m, i) < 0.0 || GETV(r, i) < 0.0 ||
                !isInteger(GETV(n, i), false) ||
@@ -150,11 +216,11 @@ NumericVector cpp_pnhyper(
                !isInteger(GETV(r, i), false)) {
       throw_warning = true;
       p[i] = NAN;
-    } else if (GETV(x, i) < GETV(r, i)) {
+    } else if (xi < GETV(r, i)) {
       p[i] = 0.0;
-    } else if (GETV(x, i) >= (GETV(n, i) + GETV(r, i))) {
+    } else if (xi >= (GETV(n, i) + GETV(r, i))) {
       p[i] = 1.0;
-    } else if (is_large_int(GETV(x, i))) {
+    } else if (is_large_int(xi)) {
       p[i] = NA_REAL;
       Rcpp::warning("NAs introduced by coercion to integer range");
     } else {
@@ -165,7 +231,7 @@ NumericVector cpp_pnhyper(
       if (!tmp.size()) {
         tmp = nhyper_table(GETV(n, i), GETV(m, i), GETV(r, i), true);
       }
-      p[i] = tmp[to_pos_int( GETV(x, i) - GETV(r, i) )];
+      p[i] = tmp[to_pos_int( xi - GETV(r, i) )];
       
     }
   } 
@@ -183,6 +249,23 @@ NumericVector cpp_pnhyper(
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_pnhyper(
+    SEXP x,
+    const NumericVector& n,
+    const NumericVector& m,
+    const NumericVector& r,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (TYPEOF(x) == INTSXP)
+    return pnhyper_values(Rcpp::IntegerVector(x), n, m, r, lower_tail,
+                          log_prob);
+  return pnhyper_values(NumericVector(x), n, m, r, lower_tail, log_prob);
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_qnhyper(
     const NumericVector& p,
@@ -254,7 +337,7 @@ NumericVector cpp_qnhyper(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_rnhyper(
+SEXP cpp_rnhyper(
     const int& nn,
     const NumericVector& n,
     const NumericVector& m,
@@ -262,46 +345,69 @@ NumericVector cpp_rnhyper(
   ) {
   
   double u;
-  NumericVector x(nn);
+  int_values x(nn);
   
   bool throw_warning = false;
   
-  std::map<std::tuple<int, int, int>, std::vector<double>> memo;
+  int Npar = std::max({
+    n.length(),
+    m.length(),
+    r.length()
+  });
   
-  for (int i = 0; i < nn; i++) {
-    if (i % 1000 == 0)
-      Rcpp::checkUserInterrupt();
+  if (to_dbl(nn) / to_dbl(Npar) < RNG_TABLE_MIN_REUSE) {
     
-    if (ISNAN(GETV(n, i)) || ISNAN(GETV(m, i)) || ISNAN(GETV(r, i)) ||
-        GETV(r, i) > GETV(m, i) || GETV(n, i) < 0.0 ||
-        GETV(m, i) < 0.0 || GETV(r, i) < 0.0 || !isInteger(GETV(n, i), false) ||
-        !isInteger(GETV(m, i), false) || !isInteger(GETV(r, i), false)) {
-      throw_warning = true;
-      x[i] = NA_REAL;
-    } else {
-      
-      std::vector<double>& tmp = memo[std::make_tuple(i % n.length(),
-                                                      i % m.length(),
-                                                      i % r.length())];
-      if (!tmp.size()) {
-        tmp = nhyper_table(GETV(n, i), GETV(m, i), GETV(r, i), true);
-      }
-      
-      u = rng_unif();
+    for (int i = 0; i < nn; i++) {
+      if (i % 1000 == 0)
+        Rcpp::checkUserInterrupt();
+      x.set(i, rng_nhyper(GETV(n, i), GETV(m, i), GETV(r, i),
+                          throw_warning));
+    }
+    
+  } else {
+    
+    // parameters are recycled, so sample by inverting cached cdf tables
+    
+    std::map<std::tuple<int, int, int>, std::vector<double>> memo;
+    
+    for (int i = 0; i < nn; i++) {
+      if (i % 1000 == 0)
+        Rcpp::checkUserInterrupt();
       
-      for (int j = 0; j <= to_pos_int( GETV(n, i) ); j++) {
-        if (tmp[j] >= u) {
-          x[i] = to_dbl(j) + GETV(r, i);
-          break;
+      if (ISNAN(GETV(n, i)) || ISNAN(GETV(m, i)) || ISNAN(GETV(r, i)) ||
+          GETV(r, i) > GETV(m, i) || GETV(n, i) < 0.0 ||
+          GETV(m, i) < 0.0 || GETV(r, i) < 0.0 || !isInteger(GETV(n, i), false) ||
+          !isInteger(GETV(m, i), false) || !isInteger(GETV(r, i), false)) {
+        throw_warning = true;
+        x.set(i, NA_REAL);
+      } else {
+        
+        std::vector<double>& tmp = memo[std::make_tuple(i % n.length(),
+                                                        i % m.length(),
+                                                        i % r.length())];
+        if (!tmp.size()) {
+          tmp = nhyper_table(GETV(n, i), GETV(m, i), GETV(r, i), true);
         }
+        
+        u = rng_unif();
+        
+        for (int j = 0; j <= to_pos_int( GETV(n, i) ); j++) {
+          if (tmp[j] >= u) {
+            x.set(i, to_dbl(j) + GETV(r, i));
+            if (sampler_diag.enabled())
+              sampler_diag.record("nhyper: table search", to_dbl(j+1));
+            break;
+          }
+        }
+        
       }
-      
     }
-  } 
+    
+  }
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
   
-  return x;
+  return x.result();
 }
 
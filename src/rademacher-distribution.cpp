@@ -6,15 +6,15 @@ using Rcpp::NumericVector;
 
 
 // [[Rcpp::export]]
-NumericVector cpp_rsign(
+SEXP cpp_rsign(
     const int& n
   ) {
   
-  NumericVector x(n);
+  int_values x(n);
   
   for (int i = 0; i < n; i++)
-    x[i] = rng_sign();
+    x.set(i, rng_sign());
   
-  return x;
+  return x.result();
 }
 
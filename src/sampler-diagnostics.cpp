@@ -0,0 +1,64 @@
+#include <Rcpp.h>
+#include "shared.h"
+// [[Rcpp::plugins(cpp11)]]
+
+
+/*
+ *  Diagnostics of samplers
+ *
+ *  Counters of the iterations used by the samplers, enabled between
+ *  the calls of cpp_sampler_diag_start and cpp_sampler_diag_stop. The
+ *  counters are owned by the stack of sampler_diag, the level returned
+ *  by cpp_sampler_diag_start is used to check that the nested
+ *  diagnostics are stopped in the reverse order.
+ *
+ */
+
+
+sampler_diagnostics sampler_diag;
+
+
+sampler_diagnostics::counters sampler_diagnostics::stop(int level) {
+  if (stack.empty())
+    Rcpp::stop("diagnostics of samplers are not enabled");
+  if (level != static_cast<int>(stack.size()))
+    Rcpp::stop("nested diagnostics of samplers are not stopped in the reverse order");
+  counters res;
+  res.swap(stack.back());
+  stack.pop_back();
+  return res;
+}
+
+
+// [[Rcpp::export]]
+int cpp_sampler_diag_start() {
+  return sampler_diag.start();
+}
+
+
+// [[Rcpp::export]]
+Rcpp::DataFrame cpp_sampler_diag_stop(int level) {
+  
+  sampler_diagnostics::counters counters = sampler_diag.stop(level);
+  
+  int k = counters.size();
+  Rcpp::CharacterVector regime(k);
+  Rcpp::NumericVector n(k), mean(k), max(k);
+  int j = 0;
+  
+  for (const auto& it : counters) {
+    regime[j] = it.first;
+    n[j] = it.second.n;
+    mean[j] = it.second.total / it.second.n;
+    max[j] = it.second.max;
+    j++;
+  }
+  
+  return Rcpp::DataFrame::create(
+    Rcpp::Named("regime") = regime,
+    Rcpp::Named("n") = n,
+    Rcpp::Named("mean") = mean,
+    Rcpp::Named("max") = max,
+    Rcpp::Named("stringsAsFactors") = false
+  );
+}
@@ -0,0 +1,176 @@
+#include <Rcpp.h>
+#include "shared.h"
+#include "shared_kernels.h"
+// [[Rcpp::plugins(cpp11)]]
+
+using Rcpp::NumericVector;
+using Rcpp::NumericMatrix;
+
+
+/*
+ *  Score functions
+ *
+ *  Parameters:
+ *  list of vectors of parameters of the distribution
+ *  w (weights of the observations, w >= 0)
+ *
+ *  log f(x[i]) and d log f(x[i]) / d theta[j]
+ *
+ *  l            = sum(w[i] * log f(x[i]))
+ *  dl/dtheta[j] = sum(w[i] * d log f(x[i]) / d theta[j])
+ *
+ *  The derivatives are computed analytically by the score kernels of
+ *  the distributions together with the log-density, in a single pass.
+ *  For the log-likelihood the values are summed (using compensated
+ *  summation) without storing them, observations with zero weights
+ *  are skipped.
+ *
+ *  The kernels are described by the structs in shared_kernels.h.
+ *
+ */
+
+
+// log-densities with the n x nscore matrix of derivatives
+// as the "gradient" attribute
+
+struct score_op {
+  const NumericVector& x;
+  const std::vector<NumericVector>& params;
+  template <typename S> NumericVector run() const {
+  
+    if (static_cast<int>(params.size()) != S::npar)
+      Rcpp::stop("wrong number of parameters");
+  
+    R_xlen_t Nmax = x.length();
+    bool empty = x.length() < 1;
+    for (int m = 0; m < S::npar; m++) {
+      empty = empty || params[m].length() < 1;
+      Nmax = std::max(Nmax, params[m].length());
+    }
+    if (empty)
+      Nmax = 0;
+  
+    NumericVector lp(Nmax);
+    NumericMatrix grad(Nmax, S::nscore);
+    double par[S::npar];
+    double g[S::nscore];
+    bool throw_warning = false;
+  
+    for (R_xlen_t i = 0; i < Nmax; i++) {
+  
+      if (i % 1000 == 0)
+        Rcpp::checkUserInterrupt();
+  
+      for (int m = 0; m < S::npar; m++)
+        par[m] = params[m][i % params[m].length()];
+  
+      lp[i] = S::score(GETV(x, i), par, g, throw_warning);
+      for (int j = 0; j < S::nscore; j++)
+        grad(i, j) = g[j];
+    }
+  
+    if (throw_warning)
+      Rcpp::warning("NaNs produced");
+  
+    lp.attr("gradient") = grad;
+    return lp;
+  }
+};
+
+
+// log-likelihood with the vector of summed derivatives
+// as the "gradient" attribute
+
+struct llscore_op {
+  const NumericVector& x;
+  const std::vector<NumericVector>& params;
+  const NumericVector& w;
+  template <typename S> NumericVector run() const {
+  
+    if (static_cast<int>(params.size()) != S::npar)
+      Rcpp::stop("wrong number of parameters");
+  
+    R_xlen_t Nmax = std::max(x.length(), w.length());
+    bool empty = x.length() < 1 || w.length() < 1;
+    for (int m = 0; m < S::npar; m++) {
+      empty = empty || params[m].length() < 1;
+      Nmax = std::max(Nmax, params[m].length());
+    }
+    if (empty)
+      Nmax = 0;
+  
+    double par[S::npar];
+    double g[S::nscore];
+    double wi, lp;
+    bool throw_warning = false;
+    compensated_sum ll;
+    std::vector<compensated_sum> dll(S::nscore);
+  
+    for (R_xlen_t i = 0; i < Nmax; i++) {
+  
+      if (i % 1000 == 0)
+        Rcpp::checkUserInterrupt();
+  
+      wi = GETV(w, i);
+      for (int m = 0; m < S::npar; m++)
+        par[m] = params[m][i % params[m].length()];
+  
+      if (ISNAN(wi)) {
+        lp = wi;
+        std::fill(g, g + S::nscore, wi);
+      } else if (wi < 0.0) {
+        throw_warning = true;
+        lp = NAN;
+        std::fill(g, g + S::nscore, NAN);
+      } else if (wi == 0.0) {
+        continue;
+      } else {
+        lp = wi * S::score(GETV(x, i), par, g, throw_warning);
+        for (int j = 0; j < S::nscore; j++)
+          g[j] *= wi;
+      }
+  
+      ll.add(lp);
+      for (int j = 0; j < S::nscore; j++)
+        dll[j].add(g[j]);
+    }
+  
+    if (throw_warning)
+      Rcpp::warning("NaNs produced");
+  
+    NumericVector grad(S::nscore);
+    for (int j = 0; j < S::nscore; j++)
+      grad[j] = dll[j].value();
+  
+    NumericVector out = NumericVector::create(ll.value());
+    out.attr("gradient") = grad;
+    return out;
+  }
+};
+
+
+// [[Rcpp::export]]
+NumericVector cpp_score(
+    const NumericVector& x,
+    const std::string& family,
+    const Rcpp::List& params
+  ) {
+  
+  std::vector<NumericVector> par_list = param_list(params);
+  
+  return dispatch_scores(family, score_op{ x, par_list });
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_llscore(
+    const NumericVector& x,
+    const std::string& family,
+    const Rcpp::List& params,
+    const NumericVector& weights
+  ) {
+  
+  std::vector<NumericVector> par_list = param_list(params);
+  
+  return dispatch_scores(family, llscore_op{ x, par_list, weights });
+}
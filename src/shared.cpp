@@ -2,18 +2,10 @@
 #include "shared.h"
 
 
-bool isInteger(double x, bool warn) {
-  if (ISNAN(x))
-    return false;
-  if (((x < 0.0) ? std::ceil(x) : std::floor(x)) != x) {
-    if (warn) {
-      char msg[55];
-      std::snprintf(msg, sizeof(msg), "non-integer x = %f", x);
-      Rcpp::warning(msg);
-    }
-    return false;
-  }
-  return true;
+void warn_non_integer(double x) {
+  char msg[55];
+  std::snprintf(msg, sizeof(msg), "non-integer x = %f", x);
+  Rcpp::warning(msg);
 }
 
 double finite_max_int(const Rcpp::NumericVector& x) {
@@ -36,6 +28,78 @@ double finite_max_int(const Rcpp::NumericVector& x) {
   return max_x;
 }
 
+double finite_max_int(const Rcpp::IntegerVector& x) {
+  int max_x = 0;
+  for (int i = 0; i < x.length(); i++) {
+    if (x[i] > max_x)
+      max_x = x[i];
+  }
+  return to_dbl(max_x);
+}
+
+int_values::int_values(int n)
+  : xi(n), nrow(n), as_double(false) { }
+
+int_values::int_values(int nrow_, int ncol)
+  : xi(Rcpp::IntegerMatrix(nrow_, ncol)), nrow(nrow_), as_double(false) { }
+
+void int_values::to_double() {
+  xd = Rcpp::NumericVector(xi.length());
+  std::transform(xi.begin(), xi.end(), xd.begin(),
+                 [](int x) { return as_dbl(x); });
+  xd.attr("dim") = xi.attr("dim");
+  xi = Rcpp::IntegerVector(0);
+  as_double = true;
+}
+
+// Vector for the results: if out is not NULL, it is the vector supplied
+// by the caller that is filled in place, so no memory is allocated.
+// Vectors that may be shared with other objects are rejected, since
+// filling them would modify those objects as well.
+
+static void check_not_shared(SEXP out) {
+  if (MAYBE_SHARED(out))
+    Rcpp::stop("'out' is shared with other objects and cannot be filled in place");
+}
+
+Rcpp::NumericVector output_vector(SEXP out, int n) {
+  if (Rf_isNull(out))
+    return Rcpp::NumericVector(n);
+  check_not_shared(out);
+  if (TYPEOF(out) != REALSXP || Rf_xlength(out) != n)
+    Rcpp::stop("'out' should be a double vector of the length of the result");
+  return Rcpp::NumericVector(out);
+}
+
+Rcpp::IntegerVector output_int_vector(SEXP out, int n) {
+  if (Rf_isNull(out))
+    return Rcpp::IntegerVector(n);
+  check_not_shared(out);
+  if (TYPEOF(out) != INTSXP || Rf_isFactor(out) || Rf_xlength(out) != n)
+    Rcpp::stop("'out' should be an integer vector of the length of the result");
+  return Rcpp::IntegerVector(out);
+}
+
+Rcpp::NumericMatrix output_matrix(SEXP out, int nrow, int ncol) {
+  if (Rf_isNull(out))
+    return Rcpp::NumericMatrix(nrow, ncol);
+  check_not_shared(out);
+  if (TYPEOF(out) != REALSXP || !Rf_isMatrix(out) ||
+      Rf_nrows(out) != nrow || Rf_ncols(out) != ncol)
+    Rcpp::stop("'out' should be a double matrix of the dimensions of the result");
+  return Rcpp::NumericMatrix(out);
+}
+
+// Parameters of a family of distributions, passed from R as a list
+// of vectors
+
+std::vector<Rcpp::NumericVector> param_list(const Rcpp::List& params) {
+  std::vector<Rcpp::NumericVector> out;
+  for (int m = 0; m < params.size(); m++)
+    out.push_back(Rcpp::as<Rcpp::NumericVector>(params[m]));
+  return out;
+}
+
 double rng_unif() {
   double u;
   // same as in base R
@@ -3,6 +3,7 @@
 #define EDCPP_SHARED_H
 
 #include <Rcpp.h>
+#include <R_ext/Applic.h>
 
 // Constants
 
@@ -10,32 +11,197 @@ static const double SQRT_2_PI    = 2.506628274631000241612;
 static const double PHI_0        = 0.3989422804014327028632;
 static const double MIN_DIFF_EPS = 1e-8;
 
+// random generation by inversion of cached cdf tables is used
+// only if parameters are recycled at least RNG_TABLE_MIN_REUSE times,
+// tables are not grown beyond RNG_TABLE_MAX_X
+
+static const int    RNG_TABLE_MIN_REUSE = 1000;
+static const double RNG_TABLE_MAX_X     = 1e4;
+
+// cached cdf tables used by quantile functions are not grown beyond
+// QTABLE_MAX_X, larger quantiles are found by bracketed search
+
+static const double QTABLE_MAX_X = 1e5;
+
+// relative tolerance and maximal number of iterations
+// for numerical inversion of cdf's
+
+static const double INVCDF_TOL   = 1e-12;
+static const int    INVCDF_MAXIT = 100;
+
 // MACROS
 
-#define GETV(x, i)      x[i % x.length()]    // wrapped indexing of vector
-#define GETM(x, i, j)   x(i % x.nrow(), j)   // wrapped indexing of matrix
+#define GETV(x, i)      x[(i) % x.length()]    // wrapped indexing of vector
+#define GETM(x, i, j)   x((i) % x.nrow(), j)   // wrapped indexing of matrix
 #define VALID_PROB(p)   ((p >= 0.0) && (p <= 1.0))
 
 // functions
 
-bool isInteger(double x, bool warn = true);
+void warn_non_integer(double x);
 double finite_max_int(const Rcpp::NumericVector& x);
+double finite_max_int(const Rcpp::IntegerVector& x);
+Rcpp::NumericVector output_vector(SEXP out, int n);
+Rcpp::IntegerVector output_int_vector(SEXP out, int n);
+Rcpp::NumericMatrix output_matrix(SEXP out, int nrow, int ncol);
+std::vector<Rcpp::NumericVector> param_list(const Rcpp::List& params);
 double rng_unif();         // standard uniform
 
 // inline functions
 
+inline bool isInteger(double x, bool warn = true);
 inline bool tol_equal(double x, double y);
 inline double phi(double x);
 inline double Phi(double x);
 inline double InvPhi(double x);
 inline double factorial(double x);
 inline double lfactorial(double x);
+inline double log_add_exp(double lx, double ly);
+inline double log_sub_exp(double lx, double ly);
 inline double rng_sign();
 inline bool is_large_int(double x); 
 inline double to_dbl(int x);
 inline int to_pos_int(double x);
+inline double as_dbl(double x);
+inline double as_dbl(int x);
+inline double log1p_diff_sq(double u);
+
+template <typename F>
+inline int search_cdf_table(double p, std::vector<double>& p_tab,
+                            F cdf_table, double max_x);
+
+template <typename F>
+inline double search_cdf_bracket(F above, double lo, double max_x);
+
+template <typename F>
+inline double log_integrate_narrow(double lo, double hi, F logpdf);
+
+template <typename CDF, typename PDF>
+inline double invcdf_numeric(double p, CDF cdf, PDF pdf,
+                             double lower, double upper, double start,
+                             bool& throw_warning);
 
 #include "shared_inline_funs.h"
 
 
+// Compensated (Neumaier) summation, used for log-likelihoods
+
+class compensated_sum {
+  
+  double sum, comp;
+  
+public:
+  
+  compensated_sum() : sum(0.0), comp(0.0) { }
+  
+  void add(double x) {
+    double t = sum + x;
+    if (std::abs(sum) >= std::abs(x))
+      comp += (sum - t) + x;
+    else
+      comp += (x - t) + sum;
+    sum = t;
+  }
+  
+  double value() const {
+    return R_FINITE(sum) ? sum + comp : sum;
+  }
+  
+};
+
+
+// Random values of discrete distributions, stored as integers while they
+// are whole numbers in the integer range. The first other value (e.g. a
+// draw above INT_MAX, or a shift by a non-integer location) switches the
+// storage to doubles, as in rbinom and rpois in R, so the double vector
+// is allocated only if it is needed.
+
+class int_values {
+  
+  Rcpp::IntegerVector xi;
+  Rcpp::NumericVector xd;
+  int nrow;
+  bool as_double;
+  
+  void to_double();
+  
+public:
+  
+  int_values(int n);
+  int_values(int nrow, int ncol);
+  
+  void set(int i, double x) {
+    if (!as_double) {
+      if (ISNAN(x)) {
+        xi[i] = NA_INTEGER;
+        return;
+      }
+      if (!is_large_int(std::abs(x)) && x == std::floor(x)) {
+        xi[i] = static_cast<int>(x);
+        return;
+      }
+      to_double();
+    }
+    xd[i] = x;
+  }
+  
+  void set(int i, int j, double x) {
+    set(i + j * nrow, x);
+  }
+  
+  SEXP result() const {
+    return as_double ? static_cast<SEXP>(xd) : static_cast<SEXP>(xi);
+  }
+  
+};
+
+
+// Diagnostics of samplers with data-dependent cost. While they are
+// enabled (sampler_diag.enabled() is true), the samplers record the
+// number of iterations (proposals of rejection samplers, steps of
+// searches) used for each value, by the regime (branch of the algorithm).
+// The counters are kept on a stack, so the diagnostics may be nested:
+// start() pushes new counters, stop() pops them, and the values are
+// recorded by all the counters on the stack.
+
+class sampler_diagnostics {
+  
+public:
+  
+  struct counter {
+    double n, total, max;
+  };
+  
+  typedef std::map<std::string, counter> counters;
+  
+private:
+  
+  std::vector<counters> stack;
+  
+public:
+  
+  bool enabled() const {
+    return !stack.empty();
+  }
+  
+  int start() {
+    stack.push_back(counters());
+    return stack.size();
+  }
+  
+  counters stop(int level);
+  
+  void record(const char* regime, double iterations) {
+    for (counters& cs : stack) {
+      counter& c = cs[regime];
+      c.n += 1.0;
+      c.total += iterations;
+      c.max = std::max(c.max, iterations);
+    }
+  }
+  
+};
+
+extern sampler_diagnostics sampler_diag;
+
+
 #endif
@@ -0,0 +1,181 @@
+#ifndef EDCPP_BOUNDED_H
+#define EDCPP_BOUNDED_H
+
+#include <Rcpp.h>
+#include "shared.h"
+
+
+/*
+ *  Random generation from unimodal discrete distributions restricted
+ *  to the integers lo, ..., hi (truncated Poisson and binomial).
+ *
+ *  The distribution is described by a struct D with:
+ *
+ *  mode()    - mode of the non-truncated distribution,
+ *  ratio(x)  - f(x+1)/f(x),
+ *  cdf(x), invcdf(p), rng() - kernels of the non-truncated distribution.
+ *
+ *  The sampler is set up once and reused for all the values sharing the
+ *  same parameters. Depending on the window and its probability it uses:
+ *
+ *  table     - for at most BOUNDED_TABLE_MAX support points, the point is
+ *              found in the table of cumulative (unnormalized) weights,
+ *  rejection - if the probability of the window is at least
+ *              BOUNDED_REJECT_MASS, values are drawn from the
+ *              non-truncated distribution until they fall in the window,
+ *  chop-down - if the sampler is reused (or the window is far in the
+ *              tail), u ~ U(0, sum of the weights) is reduced by the
+ *              weights of consecutive points starting at the mode and
+ *              moving towards the larger of the neighbouring weights;
+ *              the weights f(x)/f(mode) are obtained by recurrence, so
+ *              no special functions are evaluated per draw,
+ *  inversion - otherwise, F^-1(F(lo-1) + u*(F(hi) - F(lo-1))).
+ *
+ */
+
+
+static const int    BOUNDED_TABLE_MAX   = 16;
+static const double BOUNDED_REJECT_MASS = 0.5;
+
+// chop-down is used only if the standard deviation of the non-truncated
+// distribution is not larger than BOUNDED_CHOP_MAX_SD, so that the
+// expected number of steps stays small, or if the probability of the
+// window is below BOUNDED_INVERT_MIN_MASS, so that inversion is not
+// precise (the window is then far in the tail and the weights decay fast)
+
+static const double BOUNDED_CHOP_MAX_SD     = 50.0;
+static const double BOUNDED_INVERT_MIN_MASS = 1e-8;
+
+
+template <typename D>
+class bounded_rng {
+  
+  enum { TABLE, REJECT, CHOP, INVERT } method;
+  D dist;
+  double lo, hi, mode, pa, pb, total;
+  std::vector<double> cum;
+  
+  // weights of the points in the window relative to f(mode),
+  // computed from the mode outwards so that they do not overflow
+  
+  void weights_table() {
+    int k = static_cast<int>(hi - lo) + 1;
+    int m = static_cast<int>(mode - lo);
+    std::vector<double> w(k);
+    w[m] = 1.0;
+    for (int j = m+1; j < k; j++)
+      w[j] = w[j-1] * dist.ratio(lo + to_dbl(j-1));
+    for (int j = m-1; j >= 0; j--)
+      w[j] = w[j+1] / dist.ratio(lo + to_dbl(j));
+    cum.resize(k);
+    for (int j = 0; j < k; j++)
+      cum[j] = (j > 0 ? cum[j-1] : 0.0) + w[j];
+  }
+  
+  // sum of the weights in the window, the summation stops when
+  // the weights become negligible
+  
+  void weights_total() {
+    double x, w;
+    total = 1.0;
+    for (x = mode, w = 1.0; x < hi; x += 1.0) {
+      w *= dist.ratio(x);
+      total += w;
+      if (w <= total * DBL_EPSILON)
+        break;
+    }
+    for (x = mode, w = 1.0; x > lo; x -= 1.0) {
+      w /= dist.ratio(x - 1.0);
+      total += w;
+      if (w <= total * DBL_EPSILON)
+        break;
+    }
+  }
+  
+public:
+  
+  // the window lo, ..., hi should be non-empty; reuse is true if the
+  // sampler will be used for more than a single draw
+  
+  bounded_rng(const D& dist_, double lo_, double hi_, double sd, bool reuse)
+    : dist(dist_), lo(lo_), hi(hi_), pa(0.0), pb(1.0), total(0.0) {
+  
+    mode = std::min(std::max(dist.mode(), lo), hi);
+  
+    if (hi - lo < to_dbl(BOUNDED_TABLE_MAX)) {
+      method = TABLE;
+      weights_table();
+      return;
+    }
+  
+    if (lo > 0.0)
+      pa = dist.cdf(lo - 1.0);
+    if (R_FINITE(hi))
+      pb = dist.cdf(hi);
+  
+    if (pb - pa >= BOUNDED_REJECT_MASS) {
+      method = REJECT;
+    } else if ((reuse && sd <= BOUNDED_CHOP_MAX_SD) ||
+               pb - pa < BOUNDED_INVERT_MIN_MASS) {
+      method = CHOP;
+      weights_total();
+    } else {
+      method = INVERT;
+    }
+  }
+  
+  double draw() const {
+  
+    double u, x, x_lo, x_hi, w_lo, w_hi;
+  
+    switch (method) {
+  
+    case TABLE:
+      u = rng_unif() * cum.back();
+      for (size_t j = 0; j < cum.size(); j++) {
+        if (u < cum[j])
+          return lo + to_dbl(j);
+      }
+      return hi;
+  
+    case REJECT:
+      do {
+        x = dist.rng();
+      } while (x < lo || x > hi);
+      return x;
+  
+    case CHOP:
+      u = rng_unif() * total - 1.0;
+      x_lo = mode - 1.0;
+      x_hi = mode + 1.0;
+      w_lo = (x_lo >= lo) ? 1.0 / dist.ratio(x_lo) : 0.0;
+      w_hi = (x_hi <= hi) ? dist.ratio(mode) : 0.0;
+      while (u > 0.0 && (w_lo > 0.0 || w_hi > 0.0)) {
+        if (w_hi >= w_lo) {
+          u -= w_hi;
+          if (u <= 0.0)
+            return x_hi;
+          w_hi = (x_hi < hi) ? w_hi * dist.ratio(x_hi) : 0.0;
+          x_hi += 1.0;
+        } else {
+          u -= w_lo;
+          if (u <= 0.0)
+            return x_lo;
+          x_lo -= 1.0;
+          w_lo = (x_lo >= lo) ? w_lo / dist.ratio(x_lo) : 0.0;
+        }
+      }
+      return mode;
+  
+    default:
+      u = pa + rng_unif() * (pb - pa);
+      x = dist.invcdf(u);
+      return std::min(std::max(x, lo), hi);
+  
+    }
+  }
+  
+};
+
+
+#endif
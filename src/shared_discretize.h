@@ -0,0 +1,298 @@
+#ifndef EDCPP_DISCRETIZE_H
+#define EDCPP_DISCRETIZE_H
+
+#include <Rcpp.h>
+#include "shared.h"
+
+
+/*
+ *  Discretized continuous distributions
+ *
+ *  X = floor(Y),  Y ~ G
+ *
+ *  f(x)    = G(x+1) - G(x)
+ *  F(x)    = G(floor(x)+1)
+ *  F^-1(p) = ceiling(G^-1(p)) - 1
+ *
+ *  (the quantiles are corrected for rounding errors in G^-1 at the jumps
+ *  of F, so that F^-1(F(x)) = x)
+ *
+ *  The probabilities are computed in log space, below the center of the
+ *  distribution as the difference of log G(x+1) and log G(x), and above
+ *  it as the difference of log S(x) and log S(x+1), where S = 1 - G, so
+ *  that the difference is always taken between the smaller tail
+ *  probabilities and does not cancel out in the tails.
+ *
+ *  When consecutive values are consecutive integers (e.g. x = 0:100),
+ *  G(x+1) computed for x is reused as G(x) for the next value, so G is
+ *  evaluated only once per support point.
+ *
+ *  The continuous distribution is described by a struct C with:
+ *
+ *  npar                 - number of parameters,
+ *  support_min()        - lower bound of the support of G,
+ *  valid(par)           - are the parameters valid,
+ *  center(par)          - point where the lower tail is switched
+ *                         to the upper tail,
+ *  cdf(x, par, lower_tail, log_p), invcdf(p, par, lower_tail, log_p),
+ *  rng(par)             - distribution function, quantile function
+ *                         and random generation of G.
+ *
+ */
+
+
+// Parameters for the i-th value
+
+template <typename C>
+class discretized_rows {
+  
+  const std::vector<Rcpp::NumericVector>& params;
+  std::vector<int> key, last;
+  
+public:
+  
+  double par[C::npar];
+  double center, nans_sum;
+  bool valid;
+  
+  discretized_rows(const std::vector<Rcpp::NumericVector>& params_)
+    : params(params_), key(C::npar) { }
+  
+  int length(int n) const {
+    for (int m = 0; m < C::npar; m++)
+      n = std::max(n, static_cast<int>(params[m].length()));
+    return n;
+  }
+  
+  bool empty(int n) const {
+    for (int m = 0; m < C::npar; m++) {
+      if (params[m].length() < 1)
+        return true;
+    }
+    return n < 1;
+  }
+  
+  // loads the parameters for the i-th value, returns false if
+  // they are the same as for the previous value
+  
+  bool load(int i) {
+  
+    for (int m = 0; m < C::npar; m++)
+      key[m] = i % params[m].length();
+  
+    if (i > 0 && key == last)
+      return false;
+    last = key;
+  
+    nans_sum = 0.0;
+    for (int m = 0; m < C::npar; m++) {
+      par[m] = params[m][key[m]];
+      nans_sum += par[m];
+    }
+  
+    valid = !ISNAN(nans_sum) && C::valid(par);
+    if (valid)
+      center = C::center(par);
+    return true;
+  }
+  
+};
+
+
+// Probability mass function, x is an integer or a double vector
+
+template <typename C, typename T>
+inline Rcpp::NumericVector discretized_pdf(const T& x,
+                                           const std::vector<Rcpp::NumericVector>& params,
+                                           bool log_prob) {
+  
+  discretized_rows<C> rows(params);
+  
+  if (rows.empty(x.length()))
+    return Rcpp::NumericVector(0);
+  
+  int Nmax = rows.length(x.length());
+  Rcpp::NumericVector p(Nmax);
+  bool throw_warning = false, upper, prev_upper = false;
+  double xi, lg_x, lg_x1, prev_x = NAN, prev_lg = NAN;
+  const bool int_values = std::is_same<T, Rcpp::IntegerVector>::value;
+  
+  for (int i = 0; i < Nmax; i++) {
+  
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+  
+    if (rows.load(i))
+      prev_x = NAN;
+    xi = as_dbl(GETV(x, i));
+  
+    if (ISNAN(xi + rows.nans_sum)) {
+      p[i] = xi + rows.nans_sum;
+    } else if (!rows.valid) {
+      throw_warning = true;
+      p[i] = NAN;
+    } else if ((!int_values && !isInteger(xi)) ||
+               xi + 1.0 <= C::support_min()) {
+      p[i] = R_NegInf;
+    } else {
+  
+      // log G(x), log G(x+1) in the lower tail,
+      // log S(x), log S(x+1) in the upper tail
+  
+      upper = xi >= rows.center;
+      if (xi == prev_x && upper == prev_upper)
+        lg_x = prev_lg;
+      else
+        lg_x = C::cdf(xi, rows.par, !upper, true);
+      lg_x1 = C::cdf(xi + 1.0, rows.par, !upper, true);
+  
+      p[i] = upper ? log_sub_exp(lg_x, lg_x1) : log_sub_exp(lg_x1, lg_x);
+  
+      prev_x = xi + 1.0;
+      prev_lg = lg_x1;
+      prev_upper = upper;
+    }
+  }
+  
+  if (!log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// Distribution function
+
+template <typename C, typename T>
+inline Rcpp::NumericVector discretized_cdf(const T& x,
+                                           const std::vector<Rcpp::NumericVector>& params,
+                                           bool lower_tail, bool log_prob) {
+  
+  discretized_rows<C> rows(params);
+  
+  if (rows.empty(x.length()))
+    return Rcpp::NumericVector(0);
+  
+  int Nmax = rows.length(x.length());
+  Rcpp::NumericVector p(Nmax);
+  bool throw_warning = false;
+  double xi;
+  
+  for (int i = 0; i < Nmax; i++) {
+  
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+  
+    rows.load(i);
+    xi = as_dbl(GETV(x, i));
+  
+    if (ISNAN(xi + rows.nans_sum)) {
+      p[i] = xi + rows.nans_sum;
+    } else if (!rows.valid) {
+      throw_warning = true;
+      p[i] = NAN;
+    } else {
+      p[i] = C::cdf(std::floor(xi) + 1.0, rows.par, lower_tail, log_prob);
+    }
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// Quantile function
+
+template <typename C>
+inline Rcpp::NumericVector discretized_invcdf(const Rcpp::NumericVector& p,
+                                              const std::vector<Rcpp::NumericVector>& params,
+                                              bool lower_tail, bool log_prob) {
+  
+  discretized_rows<C> rows(params);
+  
+  if (rows.empty(p.length()))
+    return Rcpp::NumericVector(0);
+  
+  int Nmax = rows.length(p.length());
+  Rcpp::NumericVector x(Nmax);
+  bool throw_warning = false;
+  double pi, q, pq;
+  
+  for (int i = 0; i < Nmax; i++) {
+  
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+  
+    rows.load(i);
+    pi = GETV(p, i);
+  
+    if (ISNAN(pi + rows.nans_sum)) {
+      x[i] = pi + rows.nans_sum;
+    } else if (!rows.valid || (log_prob ? pi > 0.0 : !VALID_PROB(pi))) {
+      throw_warning = true;
+      x[i] = NAN;
+    } else {
+      q = std::ceil(C::invcdf(pi, rows.par, lower_tail, log_prob)) - 1.0;
+      q = std::max(q, std::floor(C::support_min()));
+  
+      // G^-1(p) may be slightly above the integer x+1 for p = F(x)
+      // because of rounding errors, then q = x+1 and F(q-1) >= p
+  
+      if (R_FINITE(q) && q > std::floor(C::support_min())) {
+        pq = C::cdf(q, rows.par, lower_tail, log_prob);
+        if (lower_tail ? pq >= pi : pq <= pi)
+          q -= 1.0;
+      }
+      x[i] = q;
+    }
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return x;
+}
+
+
+// Random generation
+
+template <typename C>
+inline SEXP discretized_rng(int n,
+                            const std::vector<Rcpp::NumericVector>& params) {
+  
+  discretized_rows<C> rows(params);
+  
+  if (rows.empty(n))
+    return Rcpp::IntegerVector(0);
+  
+  int_values x(n);
+  bool throw_warning = false;
+  
+  for (int i = 0; i < n; i++) {
+  
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+  
+    rows.load(i);
+  
+    if (!rows.valid) {
+      throw_warning = true;
+      x.set(i, NA_REAL);
+    } else {
+      x.set(i, std::floor(C::rng(rows.par)));
+    }
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NAs produced");
+  
+  return x.result();
+}
+
+
+#endif
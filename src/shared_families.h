@@ -0,0 +1,865 @@
+#ifndef EDCPP_FAMILIES_H
+#define EDCPP_FAMILIES_H
+
+#include <Rcpp.h>
+#include "shared.h"
+
+
+/*
+ *  Families of distributions used as building blocks by the generic
+ *  code (mixtures, truncation). Each family is described by a struct with:
+ *
+ *  npar        - number of parameters,
+ *  discrete    - true for distributions on integers,
+ *  fast_invcdf - true if the quantile function has closed form, so that
+ *                sampling by inversion is not slower than rng,
+ *  valid       - check of parameters (NaN's are handled by the caller),
+ *  logpdf, cdf, invcdf, rng - kernels taking pointer to the parameters,
+ *  logccdf     - log of the upper tail probability log(1-G(x)),
+ *  invlogccdf  - its inverse, used in the upper tails where G(x) rounds
+ *                to 1 (closed form, computed from cdf and invcdf, or
+ *                by search for discrete families).
+ *
+ *  The kernels are called only with valid, non-NaN parameters.
+ *
+ */
+
+
+// kernels defined in the distribution-specific files
+
+double pdf_laplace(double x, double mu, double sigma, bool& throw_warning);
+double cdf_laplace(double x, double mu, double sigma, bool& throw_warning);
+double invcdf_laplace(double p, double mu, double sigma, bool& throw_warning);
+double rng_laplace(double mu, double sigma, bool& throw_warning);
+
+double pdf_gumbel(double x, double mu, double sigma, bool& throw_warning);
+double cdf_gumbel(double x, double mu, double sigma, bool& throw_warning);
+double invcdf_gumbel(double p, double mu, double sigma, bool& throw_warning);
+double rng_gumbel(double mu, double sigma, bool& throw_warning);
+
+double pdf_gpd(double x, double mu, double sigma, double xi, bool& throw_warning);
+double cdf_gpd(double x, double mu, double sigma, double xi, bool& throw_warning);
+double invcdf_gpd(double p, double mu, double sigma, double xi, bool& throw_warning);
+double rng_gpd(double mu, double sigma, double xi, bool& throw_warning);
+
+double pdf_gev(double x, double mu, double sigma, double xi, bool& throw_warning);
+double cdf_gev(double x, double mu, double sigma, double xi, bool& throw_warning);
+double invcdf_gev(double p, double mu, double sigma, double xi, bool& throw_warning);
+double rng_gev(double mu, double sigma, double xi, bool& throw_warning);
+
+double pdf_frechet(double x, double lambda, double mu, double sigma, bool& throw_warning);
+double cdf_frechet(double x, double lambda, double mu, double sigma, bool& throw_warning);
+double invcdf_frechet(double p, double lambda, double mu, double sigma, bool& throw_warning);
+double rng_frechet(double lambda, double mu, double sigma, bool& throw_warning);
+
+double pdf_lomax(double x, double lambda, double kappa, bool& throw_warning);
+double logpdf_lomax(double x, double lambda, double kappa, bool& throw_warning);
+double cdf_lomax(double x, double lambda, double kappa, bool& throw_warning);
+double invcdf_lomax(double p, double lambda, double kappa, bool& throw_warning);
+double rng_lomax(double lambda, double kappa, bool& throw_warning);
+
+double pdf_tnorm(double x, double mu, double sigma, double a, double b, bool& throw_warning);
+double cdf_tnorm(double x, double mu, double sigma, double a, double b, bool& throw_warning);
+double invcdf_tnorm(double p, double mu, double sigma, double a, double b, bool& throw_warning);
+double rng_tnorm(double mu, double sigma, double a, double b, bool& throw_warning);
+
+double pdf_zip(double x, double lambda, double pi, bool& throw_warning, bool int_x = false);
+double cdf_zip(double x, double lambda, double pi, bool& throw_warning);
+double invcdf_zip(double p, double lambda, double pi, bool& throw_warning);
+double rng_zip(double lambda, double pi, bool& throw_warning);
+
+double pdf_zinb(double x, double r, double p, double pi, bool& throw_warning, bool int_x = false);
+double cdf_zinb(double x, double r, double p, double pi, bool& throw_warning);
+double invcdf_zinb(double pp, double r, double p, double pi, bool& throw_warning);
+double rng_zinb(double r, double p, double pi, bool& throw_warning);
+
+double pdf_zib(double x, double n, double p, double pi, bool& throw_warning, bool int_x = false);
+double cdf_zib(double x, double n, double p, double pi, bool& throw_warning);
+double invcdf_zib(double pp, double n, double p, double pi, bool& throw_warning);
+double rng_zib(double n, double p, double pi, bool& throw_warning);
+
+double logpmf_bbinom(double k, double n, double alpha, double beta, bool& throw_warning, bool int_x = false);
+std::vector<double> cdf_bbinom_table(double k, double n, double alpha, double beta);
+double rng_bbinom(double n, double alpha, double beta, bool& throw_warning);
+
+double logpmf_gpois(double x, double alpha, double beta, bool& throw_warning, bool int_x = false);
+double rng_gpois(double alpha, double beta, bool& throw_warning);
+
+double pdf_lgser(double x, double theta, bool& throw_warning, bool int_x = false);
+std::vector<double> cdf_lgser_table(double x, double theta);
+double cdf_lgser_tail(double x, double theta);
+double invcdf_lgser_tail(double p, double theta, double lo);
+double rng_lgser(double theta, bool& throw_warning);
+
+
+// Tables of cumulative probabilities of the discrete distributions
+// without closed-form cdf are kept between the scalar calls made by
+// the generic functions, keyed by the parameters. Tables are grown as
+// in search_cdf_table, but not beyond QTABLE_MAX_X; at most
+// CDF_CACHE_MAX tables are kept, the cache is emptied when it is full.
+// A table is complete when cdf_table(x) returned less than x+1 values
+// (the cdf reached 1 numerically, or the support ended).
+
+static const size_t CDF_CACHE_MAX = 8;
+
+struct cdf_table_entry {
+  std::vector<double> p_tab;
+  bool complete = false;
+};
+
+template <typename K>
+inline cdf_table_entry& cached_cdf_table(std::map<K, cdf_table_entry>& cache,
+                                         const K& key) {
+  if (cache.size() >= CDF_CACHE_MAX && cache.find(key) == cache.end())
+    cache.clear();
+  return cache[key];
+}
+
+// Grows the table so that it covers x; false is returned if
+// this would need a table longer than QTABLE_MAX_X
+
+template <typename F>
+inline bool grow_cdf_table(double x, cdf_table_entry& tab, F cdf_table) {
+  double n;
+  while (!tab.complete && to_dbl(tab.p_tab.size()) <= x) {
+    if (!tab.p_tab.empty() && to_dbl(tab.p_tab.size() - 1) >= QTABLE_MAX_X)
+      return false;
+    n = std::min(QTABLE_MAX_X,
+                 std::max(x, 2.0 * to_dbl(tab.p_tab.size()) + 63.0));
+    tab.p_tab = cdf_table(n);
+    tab.complete = to_dbl(tab.p_tab.size() - 1) < n;
+  }
+  return true;
+}
+
+// Returns F(x) for integer x >= 0, or -1 if x is beyond the table
+
+template <typename F>
+inline double cdf_cached(double x, cdf_table_entry& tab, F cdf_table) {
+  if (!grow_cdf_table(x, tab, cdf_table))
+    return -1.0;
+  if (x >= to_dbl(tab.p_tab.size()))
+    return tab.p_tab.back();
+  return tab.p_tab[static_cast<int>(x)];
+}
+
+// Returns the smallest x such that F(x) >= p, or -1 if it is beyond
+// the table
+
+template <typename F>
+inline double invcdf_cached(double p, cdf_table_entry& tab, F cdf_table) {
+  while (tab.p_tab.empty() || tab.p_tab.back() < p) {
+    if (tab.complete)
+      break;
+    if (!grow_cdf_table(to_dbl(tab.p_tab.size()), tab, cdf_table))
+      return -1.0;
+  }
+  int j = std::lower_bound(tab.p_tab.begin(), tab.p_tab.end(), p) -
+    tab.p_tab.begin();
+  return to_dbl(std::min(j, static_cast<int>(tab.p_tab.size()) - 1));
+}
+
+
+// Quantile function of a discrete family, with support starting at
+// zero or one, given the log of the upper tail probability: the smallest
+// x such that log(1-G(x)) <= lq, found by bracketed search, since the
+// quantile functions computed from 1-exp(lq) round to Inf far in the
+// upper tail
+
+template <typename F>
+inline double invlogccdf_discrete(double lq, const double* par,
+                                  bool& throw_warning) {
+  if (lq == R_NegInf)
+    return R_PosInf;
+  if (F::logccdf(0.0, par, throw_warning) <= lq)
+    return 0.0;
+  double x = search_cdf_bracket([=, &throw_warning](double k) {
+    return F::logccdf(k, par, throw_warning) <= lq;
+  }, 0.0, to_dbl(std::numeric_limits<int>::max()));
+  return (x < 0.0) ? R_PosInf : x;
+}
+
+
+// families
+
+struct family_norm {
+  static const int npar = 2;
+  static const bool discrete = false;
+  static const bool fast_invcdf = true;
+  static bool valid(const double* par) {
+    return par[1] > 0.0;
+  }
+  static double logpdf(double x, const double* par, bool& throw_warning) {
+    return R::dnorm(x, par[0], par[1], true);
+  }
+  static double cdf(double x, const double* par, bool& throw_warning) {
+    return R::pnorm(x, par[0], par[1], true, false);
+  }
+  static double invcdf(double p, const double* par, bool& throw_warning) {
+    return R::qnorm(p, par[0], par[1], true, false);
+  }
+  static double logccdf(double x, const double* par, bool& throw_warning) {
+    return R::pnorm(x, par[0], par[1], false, true);
+  }
+  static double invlogccdf(double lq, const double* par, bool& throw_warning) {
+    return R::qnorm(lq, par[0], par[1], false, true);
+  }
+  static double rng(const double* par, bool& throw_warning) {
+    return R::rnorm(par[0], par[1]);
+  }
+};
+
+struct family_pois {
+  static const int npar = 1;
+  static const bool discrete = true;
+  static const bool fast_invcdf = false;
+  static bool valid(const double* par) {
+    return par[0] >= 0.0;
+  }
+  static double logpdf(double x, const double* par, bool& throw_warning) {
+    return R::dpois(x, par[0], true);
+  }
+  static double cdf(double x, const double* par, bool& throw_warning) {
+    return R::ppois(x, par[0], true, false);
+  }
+  static double invcdf(double p, const double* par, bool& throw_warning) {
+    return R::qpois(p, par[0], true, false);
+  }
+  static double logccdf(double x, const double* par, bool& throw_warning) {
+    return R::ppois(x, par[0], false, true);
+  }
+  static double invlogccdf(double lq, const double* par, bool& throw_warning) {
+    return invlogccdf_discrete<family_pois>(lq, par, throw_warning);
+  }
+  static double rng(const double* par, bool& throw_warning) {
+    return R::rpois(par[0]);
+  }
+};
+
+struct family_laplace {
+  static const int npar = 2;
+  static const bool discrete = false;
+  static const bool fast_invcdf = true;
+  static bool valid(const double* par) {
+    return par[1] > 0.0;
+  }
+  static double logpdf(double x, const double* par, bool& throw_warning) {
+    return std::log(pdf_laplace(x, par[0], par[1], throw_warning));
+  }
+  static double cdf(double x, const double* par, bool& throw_warning) {
+    return cdf_laplace(x, par[0], par[1], throw_warning);
+  }
+  static double invcdf(double p, const double* par, bool& throw_warning) {
+    return invcdf_laplace(p, par[0], par[1], throw_warning);
+  }
+  static double logccdf(double x, const double* par, bool& throw_warning) {
+    double z = (x - par[0])/par[1];
+    if (z >= 0.0)
+      return -M_LN2 - z;
+    return std::log1p(-std::exp(z)/2.0);
+  }
+  static double invlogccdf(double lq, const double* par, bool& throw_warning) {
+    if (lq <= -M_LN2)
+      return par[0] - par[1] * (lq + M_LN2);
+    return par[0] + par[1] * std::log(-2.0 * std::expm1(lq));
+  }
+  static double rng(const double* par, bool& throw_warning) {
+    return rng_laplace(par[0], par[1], throw_warning);
+  }
+};
+
+struct family_gumbel {
+  static const int npar = 2;
+  static const bool discrete = false;
+  static const bool fast_invcdf = true;
+  static bool valid(const double* par) {
+    return par[1] > 0.0;
+  }
+  static double logpdf(double x, const double* par, bool& throw_warning) {
+    return std::log(pdf_gumbel(x, par[0], par[1], throw_warning));
+  }
+  static double cdf(double x, const double* par, bool& throw_warning) {
+    return cdf_gumbel(x, par[0], par[1], throw_warning);
+  }
+  static double invcdf(double p, const double* par, bool& throw_warning) {
+    return invcdf_gumbel(p, par[0], par[1], throw_warning);
+  }
+  static double logccdf(double x, const double* par, bool& throw_warning) {
+    double z = (x - par[0])/par[1];
+    return std::log(-std::expm1(-std::exp(-z)));
+  }
+  static double invlogccdf(double lq, const double* par, bool& throw_warning) {
+    return par[0] - par[1] * std::log(-log_sub_exp(0.0, lq));
+  }
+  static double rng(const double* par, bool& throw_warning) {
+    return rng_gumbel(par[0], par[1], throw_warning);
+  }
+};
+
+struct family_gpd {
+  static const int npar = 3;
+  static const bool discrete = false;
+  static const bool fast_invcdf = true;
+  static bool valid(const double* par) {
+    return par[1] > 0.0;
+  }
+  static double logpdf(double x, const double* par, bool& throw_warning) {
+    return std::log(pdf_gpd(x, par[0], par[1], par[2], throw_warning));
+  }
+  static double cdf(double x, const double* par, bool& throw_warning) {
+    return cdf_gpd(x, par[0], par[1], par[2], throw_warning);
+  }
+  static double invcdf(double p, const double* par, bool& throw_warning) {
+    return invcdf_gpd(p, par[0], par[1], par[2], throw_warning);
+  }
+  static double logccdf(double x, const double* par, bool& throw_warning) {
+    double z = (x - par[0])/par[1], xi = par[2];
+    if (z <= 0.0)
+      return 0.0;
+    if (xi == 0.0)
+      return -z;
+    if (xi < 0.0 && z >= -1.0/xi)
+      return R_NegInf;
+    return -std::log1p(xi*z)/xi;
+  }
+  static double invlogccdf(double lq, const double* par, bool& throw_warning) {
+    double xi = par[2];
+    if (xi == 0.0)
+      return par[0] - par[1] * lq;
+    return par[0] + par[1] * std::expm1(-xi*lq)/xi;
+  }
+  static double rng(const double* par, bool& throw_warning) {
+    return rng_gpd(par[0], par[1], par[2], throw_warning);
+  }
+};
+
+struct family_gev {
+  static const int npar = 3;
+  static const bool discrete = false;
+  static const bool fast_invcdf = true;
+  static bool valid(const double* par) {
+    return par[1] > 0.0;
+  }
+  static double logpdf(double x, const double* par, bool& throw_warning) {
+    return std::log(pdf_gev(x, par[0], par[1], par[2], throw_warning));
+  }
+  static double cdf(double x, const double* par, bool& throw_warning) {
+    return cdf_gev(x, par[0], par[1], par[2], throw_warning);
+  }
+  static double invcdf(double p, const double* par, bool& throw_warning) {
+    return invcdf_gev(p, par[0], par[1], par[2], throw_warning);
+  }
+  static double logccdf(double x, const double* par, bool& throw_warning) {
+    double z = (x - par[0])/par[1], xi = par[2], t;
+    if (xi == 0.0) {
+      t = std::exp(-z);
+    } else {
+      if (1.0 + xi*z <= 0.0)
+        return (xi > 0.0) ? 0.0 : R_NegInf;
+      t = std::exp(-std::log1p(xi*z)/xi);
+    }
+    return std::log(-std::expm1(-t));
+  }
+  static double invlogccdf(double lq, const double* par, bool& throw_warning) {
+    double xi = par[2];
+    double lt = std::log(-log_sub_exp(0.0, lq));
+    if (xi == 0.0)
+      return par[0] - par[1] * lt;
+    return par[0] + par[1] * std::expm1(-xi*lt)/xi;
+  }
+  static double rng(const double* par, bool& throw_warning) {
+    return rng_gev(par[0], par[1], par[2], throw_warning);
+  }
+};
+
+struct family_frechet {
+  static const int npar = 3;
+  static const bool discrete = false;
+  static const bool fast_invcdf = true;
+  static bool valid(const double* par) {
+    return par[0] > 0.0 && par[2] > 0.0;
+  }
+  static double logpdf(double x, const double* par, bool& throw_warning) {
+    return std::log(pdf_frechet(x, par[0], par[1], par[2], throw_warning));
+  }
+  static double cdf(double x, const double* par, bool& throw_warning) {
+    return cdf_frechet(x, par[0], par[1], par[2], throw_warning);
+  }
+  static double invcdf(double p, const double* par, bool& throw_warning) {
+    return invcdf_frechet(p, par[0], par[1], par[2], throw_warning);
+  }
+  static double logccdf(double x, const double* par, bool& throw_warning) {
+    if (x <= par[1])
+      return 0.0;
+    double z = (x - par[1])/par[2];
+    return std::log(-std::expm1(-std::pow(z, -par[0])));
+  }
+  static double invlogccdf(double lq, const double* par, bool& throw_warning) {
+    return par[1] + par[2] * std::pow(-log_sub_exp(0.0, lq), -1.0/par[0]);
+  }
+  static double rng(const double* par, bool& throw_warning) {
+    return rng_frechet(par[0], par[1], par[2], throw_warning);
+  }
+};
+
+struct family_lomax {
+  static const int npar = 2;
+  static const bool discrete = false;
+  static const bool fast_invcdf = true;
+  static bool valid(const double* par) {
+    return par[0] > 0.0 && par[1] > 0.0;
+  }
+  static double logpdf(double x, const double* par, bool& throw_warning) {
+    return logpdf_lomax(x, par[0], par[1], throw_warning);
+  }
+  static double cdf(double x, const double* par, bool& throw_warning) {
+    return cdf_lomax(x, par[0], par[1], throw_warning);
+  }
+  static double invcdf(double p, const double* par, bool& throw_warning) {
+    return invcdf_lomax(p, par[0], par[1], throw_warning);
+  }
+  static double logccdf(double x, const double* par, bool& throw_warning) {
+    if (x <= 0.0)
+      return 0.0;
+    return -par[1] * std::log1p(par[0]*x);
+  }
+  static double invlogccdf(double lq, const double* par, bool& throw_warning) {
+    return std::expm1(-lq/par[1]) / par[0];
+  }
+  static double rng(const double* par, bool& throw_warning) {
+    return rng_lomax(par[0], par[1], throw_warning);
+  }
+};
+
+struct family_tnorm {
+  static const int npar = 4;
+  static const bool discrete = false;
+  static const bool fast_invcdf = true;
+  static bool valid(const double* par) {
+    return par[1] > 0.0 && par[3] > par[2];
+  }
+  static double logpdf(double x, const double* par, bool& throw_warning) {
+    return std::log(pdf_tnorm(x, par[0], par[1], par[2], par[3], throw_warning));
+  }
+  static double cdf(double x, const double* par, bool& throw_warning) {
+    return cdf_tnorm(x, par[0], par[1], par[2], par[3], throw_warning);
+  }
+  static double invcdf(double p, const double* par, bool& throw_warning) {
+    return invcdf_tnorm(p, par[0], par[1], par[2], par[3], throw_warning);
+  }
+  static double logccdf(double x, const double* par, bool& throw_warning) {
+    return std::log1p(-cdf(x, par, throw_warning));
+  }
+  static double invlogccdf(double lq, const double* par, bool& throw_warning) {
+    return invcdf(-std::expm1(lq), par, throw_warning);
+  }
+  static double rng(const double* par, bool& throw_warning) {
+    return rng_tnorm(par[0], par[1], par[2], par[3], throw_warning);
+  }
+};
+
+struct family_zip {
+  static const int npar = 2;
+  static const bool discrete = true;
+  static const bool fast_invcdf = false;
+  static bool valid(const double* par) {
+    return par[0] > 0.0 && VALID_PROB(par[1]);
+  }
+  static double logpdf(double x, const double* par, bool& throw_warning) {
+    return std::log(pdf_zip(x, par[0], par[1], throw_warning));
+  }
+  static double cdf(double x, const double* par, bool& throw_warning) {
+    return cdf_zip(x, par[0], par[1], throw_warning);
+  }
+  static double invcdf(double p, const double* par, bool& throw_warning) {
+    return invcdf_zip(p, par[0], par[1], throw_warning);
+  }
+  static double logccdf(double x, const double* par, bool& throw_warning) {
+    return std::log1p(-cdf(x, par, throw_warning));
+  }
+  static double invlogccdf(double lq, const double* par, bool& throw_warning) {
+    return invlogccdf_discrete<family_zip>(lq, par, throw_warning);
+  }
+  static double rng(const double* par, bool& throw_warning) {
+    return rng_zip(par[0], par[1], throw_warning);
+  }
+};
+
+struct family_zinb {
+  static const int npar = 3;
+  static const bool discrete = true;
+  static const bool fast_invcdf = false;
+  static bool valid(const double* par) {
+    return par[0] >= 0.0 && isInteger(par[0], false) &&
+      VALID_PROB(par[1]) && VALID_PROB(par[2]);
+  }
+  static double logpdf(double x, const double* par, bool& throw_warning) {
+    return std::log(pdf_zinb(x, par[0], par[1], par[2], throw_warning));
+  }
+  static double cdf(double x, const double* par, bool& throw_warning) {
+    return cdf_zinb(x, par[0], par[1], par[2], throw_warning);
+  }
+  static double invcdf(double p, const double* par, bool& throw_warning) {
+    return invcdf_zinb(p, par[0], par[1], par[2], throw_warning);
+  }
+  static double logccdf(double x, const double* par, bool& throw_warning) {
+    return std::log1p(-cdf(x, par, throw_warning));
+  }
+  static double invlogccdf(double lq, const double* par, bool& throw_warning) {
+    return invlogccdf_discrete<family_zinb>(lq, par, throw_warning);
+  }
+  static double rng(const double* par, bool& throw_warning) {
+    return rng_zinb(par[0], par[1], par[2], throw_warning);
+  }
+};
+
+struct family_zib {
+  static const int npar = 3;
+  static const bool discrete = true;
+  static const bool fast_invcdf = false;
+  static bool valid(const double* par) {
+    return par[0] >= 0.0 && isInteger(par[0], false) &&
+      VALID_PROB(par[1]) && VALID_PROB(par[2]);
+  }
+  static double logpdf(double x, const double* par, bool& throw_warning) {
+    return std::log(pdf_zib(x, par[0], par[1], par[2], throw_warning));
+  }
+  static double cdf(double x, const double* par, bool& throw_warning) {
+    return cdf_zib(x, par[0], par[1], par[2], throw_warning);
+  }
+  static double invcdf(double p, const double* par, bool& throw_warning) {
+    return invcdf_zib(p, par[0], par[1], par[2], throw_warning);
+  }
+  static double logccdf(double x, const double* par, bool& throw_warning) {
+    return std::log1p(-cdf(x, par, throw_warning));
+  }
+  static double invlogccdf(double lq, const double* par, bool& throw_warning) {
+    return invlogccdf_discrete<family_zib>(lq, par, throw_warning);
+  }
+  static double rng(const double* par, bool& throw_warning) {
+    return rng_zib(par[0], par[1], par[2], throw_warning);
+  }
+};
+
+struct family_gamma {
+  static const int npar = 2;
+  static const bool discrete = false;
+  static const bool fast_invcdf = false;
+  static bool valid(const double* par) {
+    return par[0] > 0.0 && par[1] > 0.0;
+  }
+  static double logpdf(double x, const double* par, bool& throw_warning) {
+    return R::dgamma(x, par[0], 1.0/par[1], true);
+  }
+  static double cdf(double x, const double* par, bool& throw_warning) {
+    return R::pgamma(x, par[0], 1.0/par[1], true, false);
+  }
+  static double invcdf(double p, const double* par, bool& throw_warning) {
+    return R::qgamma(p, par[0], 1.0/par[1], true, false);
+  }
+  static double logccdf(double x, const double* par, bool& throw_warning) {
+    return R::pgamma(x, par[0], 1.0/par[1], false, true);
+  }
+  static double invlogccdf(double lq, const double* par, bool& throw_warning) {
+    return R::qgamma(lq, par[0], 1.0/par[1], false, true);
+  }
+  static double rng(const double* par, bool& throw_warning) {
+    return R::rgamma(par[0], 1.0/par[1]);
+  }
+};
+
+struct family_lnorm {
+  static const int npar = 2;
+  static const bool discrete = false;
+  static const bool fast_invcdf = true;
+  static bool valid(const double* par) {
+    return par[1] > 0.0;
+  }
+  static double logpdf(double x, const double* par, bool& throw_warning) {
+    return R::dlnorm(x, par[0], par[1], true);
+  }
+  static double cdf(double x, const double* par, bool& throw_warning) {
+    return R::plnorm(x, par[0], par[1], true, false);
+  }
+  static double invcdf(double p, const double* par, bool& throw_warning) {
+    return R::qlnorm(p, par[0], par[1], true, false);
+  }
+  static double logccdf(double x, const double* par, bool& throw_warning) {
+    return R::plnorm(x, par[0], par[1], false, true);
+  }
+  static double invlogccdf(double lq, const double* par, bool& throw_warning) {
+    return R::qlnorm(lq, par[0], par[1], false, true);
+  }
+  static double rng(const double* par, bool& throw_warning) {
+    return R::rlnorm(par[0], par[1]);
+  }
+};
+
+struct family_weibull {
+  static const int npar = 2;
+  static const bool discrete = false;
+  static const bool fast_invcdf = true;
+  static bool valid(const double* par) {
+    return par[0] > 0.0 && par[1] > 0.0;
+  }
+  static double logpdf(double x, const double* par, bool& throw_warning) {
+    return R::dweibull(x, par[0], par[1], true);
+  }
+  static double cdf(double x, const double* par, bool& throw_warning) {
+    return R::pweibull(x, par[0], par[1], true, false);
+  }
+  static double invcdf(double p, const double* par, bool& throw_warning) {
+    return R::qweibull(p, par[0], par[1], true, false);
+  }
+  static double logccdf(double x, const double* par, bool& throw_warning) {
+    return R::pweibull(x, par[0], par[1], false, true);
+  }
+  static double invlogccdf(double lq, const double* par, bool& throw_warning) {
+    return R::qweibull(lq, par[0], par[1], false, true);
+  }
+  static double rng(const double* par, bool& throw_warning) {
+    return R::rweibull(par[0], par[1]);
+  }
+};
+
+struct family_binom {
+  static const int npar = 2;
+  static const bool discrete = true;
+  static const bool fast_invcdf = false;
+  static bool valid(const double* par) {
+    return par[0] >= 0.0 && isInteger(par[0], false) && VALID_PROB(par[1]);
+  }
+  static double logpdf(double x, const double* par, bool& throw_warning) {
+    return R::dbinom(x, par[0], par[1], true);
+  }
+  static double cdf(double x, const double* par, bool& throw_warning) {
+    return R::pbinom(x, par[0], par[1], true, false);
+  }
+  static double invcdf(double p, const double* par, bool& throw_warning) {
+    return R::qbinom(p, par[0], par[1], true, false);
+  }
+  static double logccdf(double x, const double* par, bool& throw_warning) {
+    return R::pbinom(x, par[0], par[1], false, true);
+  }
+  static double invlogccdf(double lq, const double* par, bool& throw_warning) {
+    return invlogccdf_discrete<family_binom>(lq, par, throw_warning);
+  }
+  static double rng(const double* par, bool& throw_warning) {
+    return R::rbinom(par[0], par[1]);
+  }
+};
+
+struct family_nbinom {
+  static const int npar = 2;
+  static const bool discrete = true;
+  static const bool fast_invcdf = false;
+  static bool valid(const double* par) {
+    return par[0] > 0.0 && par[1] > 0.0 && par[1] <= 1.0;
+  }
+  static double logpdf(double x, const double* par, bool& throw_warning) {
+    return R::dnbinom(x, par[0], par[1], true);
+  }
+  static double cdf(double x, const double* par, bool& throw_warning) {
+    return R::pnbinom(x, par[0], par[1], true, false);
+  }
+  static double invcdf(double p, const double* par, bool& throw_warning) {
+    return R::qnbinom(p, par[0], par[1], true, false);
+  }
+  static double logccdf(double x, const double* par, bool& throw_warning) {
+    return R::pnbinom(x, par[0], par[1], false, true);
+  }
+  static double invlogccdf(double lq, const double* par, bool& throw_warning) {
+    return invlogccdf_discrete<family_nbinom>(lq, par, throw_warning);
+  }
+  static double rng(const double* par, bool& throw_warning) {
+    return R::rnbinom(par[0], par[1]);
+  }
+};
+
+struct family_bbinom {
+  static const int npar = 3;
+  static const bool discrete = true;
+  static const bool fast_invcdf = false;
+  static bool valid(const double* par) {
+    return par[0] >= 0.0 && isInteger(par[0], false) &&
+      par[1] > 0.0 && par[2] > 0.0;
+  }
+  static double logpdf(double x, const double* par, bool& throw_warning) {
+    return logpmf_bbinom(x, par[0], par[1], par[2], throw_warning);
+  }
+  static cdf_table_entry& table(double n, double alpha, double beta) {
+    static std::map<std::tuple<double, double, double>, cdf_table_entry> cache;
+    return cached_cdf_table(cache, std::make_tuple(n, alpha, beta));
+  }
+  static double cdf(double x, const double* par, bool& throw_warning) {
+    if (x < 0.0)
+      return 0.0;
+    if (x >= par[0])
+      return 1.0;
+    double n = par[0], a = par[1], b = par[2];
+    double k = std::floor(x), pk;
+    pk = cdf_cached(k, table(n, a, b), [=](double m) {
+      return cdf_bbinom_table(std::min(m, n), n, a, b);
+    });
+    if (pk >= 0.0)
+      return pk;
+    // F(k) = 1 - G(n-k-1), where G is the cdf of n-X ~ BB(n, beta, alpha)
+    pk = cdf_cached(n - k - 1.0, table(n, b, a), [=](double m) {
+      return cdf_bbinom_table(std::min(m, n), n, b, a);
+    });
+    if (pk >= 0.0)
+      return 1.0 - pk;
+    return cdf_bbinom_table(k, n, a, b).back();
+  }
+  static double invcdf(double p, const double* par, bool& throw_warning) {
+    if (p == 1.0)
+      return par[0];
+    double n = par[0], a = par[1], b = par[2];
+    double k = invcdf_cached(p, table(n, a, b), [=](double m) {
+      return cdf_bbinom_table(std::min(m, n), n, a, b);
+    });
+    if (k >= 0.0)
+      return k;
+    return search_cdf_bracket([=, &throw_warning](double m) {
+      return cdf(m, par, throw_warning) >= p;
+    }, QTABLE_MAX_X, n);
+  }
+  static double logccdf(double x, const double* par, bool& throw_warning) {
+    return std::log1p(-cdf(x, par, throw_warning));
+  }
+  static double invlogccdf(double lq, const double* par, bool& throw_warning) {
+    return invlogccdf_discrete<family_bbinom>(lq, par, throw_warning);
+  }
+  static double rng(const double* par, bool& throw_warning) {
+    return rng_bbinom(par[0], par[1], par[2], throw_warning);
+  }
+};
+
+struct family_gpois {
+  static const int npar = 2;
+  static const bool discrete = true;
+  static const bool fast_invcdf = false;
+  static bool valid(const double* par) {
+    return par[0] > 0.0 && par[1] > 0.0;
+  }
+  static double logpdf(double x, const double* par, bool& throw_warning) {
+    return logpmf_gpois(x, par[0], 1.0/par[1], throw_warning);
+  }
+  // gamma-Poisson is the negative binomial with prob = beta/(1+beta)
+  static double cdf(double x, const double* par, bool& throw_warning) {
+    return R::pnbinom(x, par[0], par[1]/(1.0+par[1]), true, false);
+  }
+  static double invcdf(double p, const double* par, bool& throw_warning) {
+    return R::qnbinom(p, par[0], par[1]/(1.0+par[1]), true, false);
+  }
+  static double logccdf(double x, const double* par, bool& throw_warning) {
+    return R::pnbinom(x, par[0], par[1]/(1.0+par[1]), false, true);
+  }
+  static double invlogccdf(double lq, const double* par, bool& throw_warning) {
+    return invlogccdf_discrete<family_gpois>(lq, par, throw_warning);
+  }
+  static double rng(const double* par, bool& throw_warning) {
+    return rng_gpois(par[0], 1.0/par[1], throw_warning);
+  }
+};
+
+struct family_lgser {
+  static const int npar = 1;
+  static const bool discrete = true;
+  static const bool fast_invcdf = false;
+  static bool valid(const double* par) {
+    return par[0] > 0.0 && par[0] < 1.0;
+  }
+  static double logpdf(double x, const double* par, bool& throw_warning) {
+    return std::log(pdf_lgser(x, par[0], throw_warning));
+  }
+  static cdf_table_entry& table(double theta) {
+    static std::map<std::tuple<double>, cdf_table_entry> cache;
+    return cached_cdf_table(cache, std::make_tuple(theta));
+  }
+  static double cdf(double x, const double* par, bool& throw_warning) {
+    if (x < 1.0)
+      return 0.0;
+    if (!R_FINITE(x))
+      return 1.0;
+    double t = par[0], k = std::floor(x);
+    double pk = cdf_cached(k, table(t), [=](double m) {
+      return cdf_lgser_table(m, t);
+    });
+    return (pk >= 0.0) ? pk : cdf_lgser_tail(k, t);
+  }
+  static double invcdf(double p, const double* par, bool& throw_warning) {
+    if (p == 1.0)
+      return R_PosInf;
+    double t = par[0];
+    cdf_table_entry& tab = table(t);
+    double k = invcdf_cached(p, tab, [=](double m) {
+      return cdf_lgser_table(m, t);
+    });
+    if (k >= 0.0)
+      return std::max(1.0, k);
+    return invcdf_lgser_tail(p, t, to_dbl(tab.p_tab.size() - 1));
+  }
+  static double logccdf(double x, const double* par, bool& throw_warning) {
+    return std::log1p(-cdf(x, par, throw_warning));
+  }
+  static double invlogccdf(double lq, const double* par, bool& throw_warning) {
+    return invlogccdf_discrete<family_lgser>(lq, par, throw_warning);
+  }
+  static double rng(const double* par, bool& throw_warning) {
+    return rng_lgser(par[0], throw_warning);
+  }
+};
+
+
+// Calls op.run<F>() for the family F with given name. The op
+// is a struct holding the arguments, with templated run() method.
+
+template <typename OP>
+inline auto dispatch_family(const std::string& family, const OP& op)
+  -> decltype(op.template run<family_norm>()) {
+  if (family == "norm")
+    return op.template run<family_norm>();
+  if (family == "pois")
+    return op.template run<family_pois>();
+  if (family == "laplace")
+    return op.template run<family_laplace>();
+  if (family == "gumbel")
+    return op.template run<family_gumbel>();
+  if (family == "gpd")
+    return op.template run<family_gpd>();
+  if (family == "gev")
+    return op.template run<family_gev>();
+  if (family == "frechet")
+    return op.template run<family_frechet>();
+  if (family == "lomax")
+    return op.template run<family_lomax>();
+  if (family == "tnorm")
+    return op.template run<family_tnorm>();
+  if (family == "zip")
+    return op.template run<family_zip>();
+  if (family == "zinb")
+    return op.template run<family_zinb>();
+  if (family == "zib")
+    return op.template run<family_zib>();
+  if (family == "gamma")
+    return op.template run<family_gamma>();
+  if (family == "lnorm")
+    return op.template run<family_lnorm>();
+  if (family == "weibull")
+    return op.template run<family_weibull>();
+  if (family == "binom")
+    return op.template run<family_binom>();
+  if (family == "nbinom")
+    return op.template run<family_nbinom>();
+  if (family == "bbinom")
+    return op.template run<family_bbinom>();
+  if (family == "gpois")
+    return op.template run<family_gpois>();
+  if (family == "lgser")
+    return op.template run<family_lgser>();
+  Rcpp::stop("unknown family of distributions");
+}
+
+
+#endif
@@ -0,0 +1,429 @@
+#ifndef EDCPP_INFLATION_H
+#define EDCPP_INFLATION_H
+
+#include <Rcpp.h>
+#include "shared.h"
+
+
+/*
+ *  Zero-inflated and hurdle versions of discrete distributions
+ *
+ *  Zero-inflated:
+ *
+ *  f(0) = pi + (1-pi) * g(0)
+ *  f(x) = (1-pi) * g(x)                        for x > 0
+ *  F(x) = pi + (1-pi) * G(x)
+ *
+ *  Hurdle:
+ *
+ *  f(0) = pi
+ *  f(x) = (1-pi) * g(x) / (1 - G(0))           for x > 0
+ *  F(x) = pi + (1-pi) * (G(x) - G(0)) / (1 - G(0))
+ *
+ *  where g, G are the probability mass and distribution function of the
+ *  family. In both cases the log-probability is log(f(0)) for zeros and
+ *  log(1-pi) - log(norm) + log(g(x)) otherwise, with norm = 1 for the
+ *  zero-inflated and norm = 1 - G(0) for the hurdle distributions. Both
+ *  constants are computed once per unique combination of parameters, so
+ *  the only per-value work is the choice between them and, for non-zero
+ *  values, log(g(x)).
+ *
+ */
+
+
+// constants for a combination of parameters
+
+struct inflated_consts {
+  double g0;          // G(0)
+  double log_f0;      // log(f(0))
+  double log_nz;      // log(1-pi) - log(norm)
+};
+
+
+// Parameters and constants for the i-th value
+
+template <typename F>
+class inflated_rows {
+  
+  const std::vector<Rcpp::NumericVector>& params;
+  const Rcpp::NumericVector& prob;
+  bool hurdle, memoize;
+  std::map<std::vector<int>, inflated_consts> memo;
+  std::vector<int> key, last;
+  
+public:
+  
+  double par[F::npar];
+  double pi, nans_sum;
+  inflated_consts c;
+  bool valid;
+  
+  inflated_rows(const std::vector<Rcpp::NumericVector>& params_,
+                const Rcpp::NumericVector& prob_,
+                bool hurdle_, int n)
+    : params(params_), prob(prob_), hurdle(hurdle_), key(F::npar + 1) {
+  
+    if (static_cast<int>(params.size()) != F::npar)
+      Rcpp::stop("wrong number of parameters");
+  
+    int Npar = prob.length();
+    for (int m = 0; m < F::npar; m++)
+      Npar = std::max(Npar, static_cast<int>(params[m].length()));
+    memoize = length(n) > Npar;
+  }
+  
+  int length(int n) const {
+    n = std::max(n, static_cast<int>(prob.length()));
+    for (int m = 0; m < F::npar; m++)
+      n = std::max(n, static_cast<int>(params[m].length()));
+    return n;
+  }
+  
+  bool empty(int n) const {
+    for (int m = 0; m < F::npar; m++) {
+      if (params[m].length() < 1)
+        return true;
+    }
+    return n < 1 || prob.length() < 1;
+  }
+  
+  // loads the parameters for the i-th value; valid is false if the
+  // parameters are not valid (or, for hurdle distributions, if the family
+  // has no positive values)
+  
+  void load(int i, bool& throw_warning) {
+  
+    for (int m = 0; m < F::npar; m++)
+      key[m] = i % params[m].length();
+    key[F::npar] = i % prob.length();
+  
+    if (i > 0 && key == last)
+      return;
+    last = key;
+  
+    nans_sum = 0.0;
+    for (int m = 0; m < F::npar; m++) {
+      par[m] = params[m][key[m]];
+      nans_sum += par[m];
+    }
+    pi = prob[key[F::npar]];
+    nans_sum += pi;
+  
+    valid = !ISNAN(nans_sum) && F::valid(par) && VALID_PROB(pi);
+    if (!valid)
+      return;
+  
+    if (memoize) {
+      auto it = memo.find(key);
+      if (it == memo.end())
+        it = memo.insert(std::make_pair(key, consts(throw_warning))).first;
+      c = it->second;
+    } else {
+      c = consts(throw_warning);
+    }
+  
+    valid = !hurdle || c.g0 < 1.0 || pi == 1.0;
+  }
+  
+  inflated_consts consts(bool& throw_warning) const {
+    inflated_consts out;
+    double log_g0 = F::logpdf(0.0, par, throw_warning);
+    out.g0 = F::cdf(0.0, par, throw_warning);
+    if (pi == 1.0) {
+      out.log_f0 = 0.0;
+      out.log_nz = R_NegInf;
+    } else if (hurdle) {
+      out.log_f0 = std::log(pi);
+      out.log_nz = log1p(-pi) - log1p(-out.g0);
+    } else {
+      out.log_f0 = log_add_exp(std::log(pi), log1p(-pi) + log_g0);
+      out.log_nz = log1p(-pi);
+    }
+    return out;
+  }
+  
+  // log-probability of x
+  
+  double logpdf(double x, bool& throw_warning) const {
+    if (x == 0.0)
+      return c.log_f0;
+    if (x < 0.0 || !isInteger(x) || !R_FINITE(x))
+      return R_NegInf;
+    return c.log_nz + F::logpdf(x, par, throw_warning);
+  }
+  
+  double cdf(double x, bool& throw_warning) const {
+    if (x < 0.0)
+      return 0.0;
+    if (x == R_PosInf)
+      return 1.0;
+    double gx = F::cdf(x, par, throw_warning);
+    if (hurdle)
+      gx = (pi == 1.0) ? 0.0 : (gx - c.g0) / (1.0 - c.g0);
+    return pi + (1.0 - pi) * gx;
+  }
+  
+  double invcdf(double p, bool& throw_warning) const {
+    if (p <= pi + (1.0 - pi) * (hurdle ? 0.0 : c.g0) || pi == 1.0)
+      return 0.0;
+    double q = (p - pi) / (1.0 - pi);
+    if (hurdle)
+      q = c.g0 + q * (1.0 - c.g0);
+    // fuzz against rounding errors, as in R's discrete quantile functions
+    q *= 1.0 - 64.0 * DBL_EPSILON;
+    return std::max(1.0, F::invcdf(std::min(q, 1.0), par, throw_warning));
+  }
+  
+  // non-zero values of the hurdle distributions are drawn by rejection
+  // if zeros have probability below 1/2 and by inversion otherwise
+  
+  double rng(bool& throw_warning) const {
+    if (rng_unif() < pi)
+      return 0.0;
+    if (!hurdle)
+      return F::rng(par, throw_warning);
+    double x;
+    if (c.g0 < 0.5) {
+      do {
+        x = F::rng(par, throw_warning);
+      } while (x == 0.0);
+      return x;
+    }
+    x = F::invcdf(c.g0 + rng_unif() * (1.0 - c.g0), par, throw_warning);
+    return std::max(1.0, x);
+  }
+  
+};
+
+
+// Probability mass function
+
+template <typename F>
+inline Rcpp::NumericVector inflated_pdf(const Rcpp::NumericVector& x,
+                                        const std::vector<Rcpp::NumericVector>& params,
+                                        const Rcpp::NumericVector& pi,
+                                        bool hurdle, bool log_prob) {
+  
+  inflated_rows<F> rows(params, pi, hurdle, x.length());
+  
+  if (rows.empty(x.length()))
+    return Rcpp::NumericVector(0);
+  
+  int Nmax = rows.length(x.length());
+  Rcpp::NumericVector p(Nmax);
+  bool throw_warning = false;
+  double xi;
+  
+  for (int i = 0; i < Nmax; i++) {
+  
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+  
+    rows.load(i, throw_warning);
+    xi = GETV(x, i);
+  
+    if (ISNAN(xi + rows.nans_sum)) {
+      p[i] = xi + rows.nans_sum;
+    } else if (!rows.valid) {
+      throw_warning = true;
+      p[i] = NAN;
+    } else {
+      p[i] = rows.logpdf(xi, throw_warning);
+    }
+  }
+  
+  if (!log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// Distribution function
+
+template <typename F>
+inline Rcpp::NumericVector inflated_cdf(const Rcpp::NumericVector& x,
+                                        const std::vector<Rcpp::NumericVector>& params,
+                                        const Rcpp::NumericVector& pi,
+                                        bool hurdle, bool lower_tail, bool log_prob) {
+  
+  inflated_rows<F> rows(params, pi, hurdle, x.length());
+  
+  if (rows.empty(x.length()))
+    return Rcpp::NumericVector(0);
+  
+  int Nmax = rows.length(x.length());
+  Rcpp::NumericVector p(Nmax);
+  bool throw_warning = false;
+  double xi;
+  
+  for (int i = 0; i < Nmax; i++) {
+  
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+  
+    rows.load(i, throw_warning);
+    xi = GETV(x, i);
+  
+    if (ISNAN(xi + rows.nans_sum)) {
+      p[i] = xi + rows.nans_sum;
+    } else if (!rows.valid) {
+      throw_warning = true;
+      p[i] = NAN;
+    } else {
+      p[i] = rows.cdf(xi, throw_warning);
+    }
+  }
+  
+  if (!lower_tail)
+    p = 1.0 - p;
+  
+  if (log_prob)
+    p = Rcpp::log(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// Quantile function
+
+template <typename F>
+inline Rcpp::NumericVector inflated_invcdf(const Rcpp::NumericVector& p,
+                                           const std::vector<Rcpp::NumericVector>& params,
+                                           const Rcpp::NumericVector& pi,
+                                           bool hurdle, bool lower_tail, bool log_prob) {
+  
+  inflated_rows<F> rows(params, pi, hurdle, p.length());
+  
+  if (rows.empty(p.length()))
+    return Rcpp::NumericVector(0);
+  
+  int Nmax = rows.length(p.length());
+  Rcpp::NumericVector x(Nmax);
+  Rcpp::NumericVector pp = Rcpp::clone(p);
+  bool throw_warning = false;
+  double pr;
+  
+  if (log_prob)
+    pp = Rcpp::exp(pp);
+  
+  if (!lower_tail)
+    pp = 1.0 - pp;
+  
+  for (int i = 0; i < Nmax; i++) {
+  
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+  
+    rows.load(i, throw_warning);
+    pr = GETV(pp, i);
+  
+    if (ISNAN(pr + rows.nans_sum)) {
+      x[i] = pr + rows.nans_sum;
+    } else if (!rows.valid || !VALID_PROB(pr)) {
+      throw_warning = true;
+      x[i] = NAN;
+    } else {
+      x[i] = rows.invcdf(pr, throw_warning);
+    }
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return x;
+}
+
+
+// Random generation
+
+template <typename F>
+inline Rcpp::NumericVector inflated_rng(int n,
+                                        const std::vector<Rcpp::NumericVector>& params,
+                                        const Rcpp::NumericVector& pi,
+                                        bool hurdle) {
+  
+  inflated_rows<F> rows(params, pi, hurdle, n);
+  
+  if (rows.empty(n))
+    return Rcpp::NumericVector(0);
+  
+  Rcpp::NumericVector x(n);
+  bool throw_warning = false;
+  
+  for (int i = 0; i < n; i++) {
+  
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+  
+    rows.load(i, throw_warning);
+  
+    if (!rows.valid) {
+      throw_warning = true;
+      x[i] = NA_REAL;
+    } else {
+      x[i] = rows.rng(throw_warning);
+    }
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NAs produced");
+  
+  return x;
+}
+
+
+// Log-likelihood, i.e. the sum of log-probabilities, computed in a single
+// pass without storing the log-probabilities; zeros only add the cached
+// log(f(0)). The sum is compensated (Kahan-Babuska-Neumaier).
+
+template <typename F>
+inline double inflated_loglik(const Rcpp::NumericVector& x,
+                              const std::vector<Rcpp::NumericVector>& params,
+                              const Rcpp::NumericVector& pi,
+                              bool hurdle) {
+  
+  inflated_rows<F> rows(params, pi, hurdle, x.length());
+  
+  if (rows.empty(x.length()))
+    return 0.0;
+  
+  int Nmax = rows.length(x.length());
+  bool throw_warning = false;
+  double xi, lp;
+  compensated_sum ll;
+  
+  for (int i = 0; i < Nmax; i++) {
+  
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+  
+    rows.load(i, throw_warning);
+    xi = GETV(x, i);
+  
+    if (ISNAN(xi + rows.nans_sum)) {
+      lp = xi + rows.nans_sum;
+    } else if (!rows.valid) {
+      throw_warning = true;
+      lp = NAN;
+    } else {
+      lp = rows.logpdf(xi, throw_warning);
+    }
+  
+    ll.add(lp);
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return ll.value();
+}
+
+
+#endif
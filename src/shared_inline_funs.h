@@ -6,6 +6,20 @@
 #include <Rcpp.h>
 
 
+// the check is inlined, since it is made for every value of discrete
+// distributions, only the warning is issued out of line
+
+inline bool isInteger(double x, bool warn) {
+  if (ISNAN(x))
+    return false;
+  if (((x < 0.0) ? std::ceil(x) : std::floor(x)) != x) {
+    if (warn)
+      warn_non_integer(x);
+    return false;
+  }
+  return true;
+}
+
 inline bool tol_equal(double x, double y) {
   return std::abs(x - y) < MIN_DIFF_EPS;
 }
@@ -30,6 +44,27 @@ inline double lfactorial(double x) {
   return R::lgammafn(x + 1.0);
 }
 
+// log(exp(lx) + exp(ly)) without overflow, exp(-Inf) == 0 terms are allowed
+
+inline double log_add_exp(double lx, double ly) {
+  if (lx == R_NegInf)
+    return ly;
+  if (ly == R_NegInf)
+    return lx;
+  return std::max(lx, ly) + std::log1p(std::exp(-std::abs(lx - ly)));
+}
+
+// log(exp(lx) - exp(ly)) for lx >= ly, negative differences that are
+// due to rounding errors give -Inf
+
+inline double log_sub_exp(double lx, double ly) {
+  if (ly == R_NegInf)
+    return lx;
+  if (lx <= ly)
+    return R_NegInf;
+  return R::logspace_sub(lx, ly);
+}
+
 inline double rng_sign() {
   double u = rng_unif();
   return (u > 0.5) ? 1.0 : -1.0;
@@ -53,6 +88,202 @@ inline int to_pos_int(double x) {
   return static_cast<int>(x);
 }
 
+// (log(1+u) - u/(1+u)) / u^2, used by the derivatives of GEV and GPD
+// with respect to xi; the series is used for small u where the
+// difference cancels out (the limit for u = 0 is 1/2)
+
+inline double log1p_diff_sq(double u) {
+  if (std::abs(u) < 1e-3)
+    return 0.5 - u*(2.0/3.0 - u*(0.75 - u*0.8));
+  return (std::log1p(u) - u/(1.0 + u)) / (u*u);
+}
+
+// log of the integral of exp(logpdf(x)) over (lo, hi) by the 5-point
+// Gauss-Legendre rule, for intervals narrow enough that the log-density
+// is smooth and almost linear on them, where the difference of the
+// distribution functions would cancel out
+
+template <typename F>
+inline double log_integrate_narrow(double lo, double hi, F logpdf) {
+  static const double node[5] = {
+    0.0, -0.5384693101056831, 0.5384693101056831,
+    -0.9061798459386640, 0.9061798459386640
+  };
+  static const double weight[5] = {
+    0.5688888888888889, 0.4786286704993665, 0.4786286704993665,
+    0.2369268850561891, 0.2369268850561891
+  };
+  double mid = (lo + hi)/2.0, half = (hi - lo)/2.0;
+  double lf[5], lmax = R_NegInf, s = 0.0;
+  for (int k = 0; k < 5; k++) {
+    lf[k] = logpdf(mid + half*node[k]);
+    lmax = std::max(lmax, lf[k]);
+  }
+  if (lmax == R_NegInf)
+    return R_NegInf;
+  for (int k = 0; k < 5; k++)
+    s += weight[k] * std::exp(lf[k] - lmax);
+  return lmax + std::log(half*s);
+}
+
+// values of discrete distributions passed from R as integer or double
+// vectors, NA_INTEGER is read as NA_REAL
+
+inline double as_dbl(double x) {
+  return x;
+}
+
+inline double as_dbl(int x) {
+  return (x == NA_INTEGER) ? NA_REAL : static_cast<double>(x);
+}
+
+// Returns the smallest x such that p_tab[x] >= p. The cumulative
+// table is lazily rebuilt by cdf_table(x) with doubled length until it
+// covers p, stops growing (reaches 1 numerically), or reaches max_x;
+// in the last case -1 is returned.
+
+template <typename F>
+inline int search_cdf_table(double p, std::vector<double>& p_tab,
+                            F cdf_table, double max_x) {
+  double last;
+  while (p_tab.empty() || p_tab.back() < p) {
+    if (!p_tab.empty() && to_dbl(p_tab.size() - 1) >= max_x)
+      return -1;
+    last = p_tab.empty() ? -1.0 : p_tab.back();
+    p_tab = cdf_table(std::min(max_x, 2.0 * to_dbl(p_tab.size()) + 63.0));
+    if (p_tab.back() <= last)
+      break;
+  }
+  int j = std::lower_bound(p_tab.begin(), p_tab.end(), p) - p_tab.begin();
+  return std::min(j, static_cast<int>(p_tab.size()) - 1);
+}
+
+// Returns the smallest integer x in (lo, max_x] such that above(x) is
+// true, where above(x) is monotone in x and false at lo (e.g. F(x) >= p);
+// -1 is returned if it is false at max_x. The bracket is found by
+// doubling the distance from lo and narrowed by bisection, so only
+// O(log x) evaluations are needed and nothing is stored.
+
+template <typename F>
+inline double search_cdf_bracket(F above, double lo, double max_x) {
+  double hi, mid;
+  double step = std::max(1.0, lo);
+  for (;;) {
+    hi = std::min(lo + step, max_x);
+    if (above(hi))
+      break;
+    if (hi >= max_x)
+      return -1.0;
+    lo = hi;
+    step *= 2.0;
+  }
+  while (hi - lo > 1.0) {
+    mid = std::floor((lo + hi)/2.0);
+    if (above(mid))
+      hi = mid;
+    else
+      lo = mid;
+  }
+  return hi;
+}
+
+template <typename F>
+double invcdf_zeroin_fn(double x, void* info) {
+  return (*static_cast<F*>(info))(x);
+}
+
+// Solves cdf(x) = p for continuous distributions with support
+// [lower, upper] (bounds may be infinite). Newton iterations, using pdf
+// as the derivative, start at start and are kept inside a bracket that
+// is narrowed after every evaluation. While the bracket is unbounded,
+// steps are limited to doubling the distance from zero; once it is
+// finite, steps leaving it are replaced by Brent's method (R_zeroin2).
+// Starting at the solution for a nearby p (warm start) usually needs
+// only a few iterations. If the solution is not found within
+// INVCDF_MAXIT iterations, or the bracket does not contain it,
+// NaN is returned and throw_warning is set.
+
+template <typename CDF, typename PDF>
+inline double invcdf_numeric(double p, CDF cdf, PDF pdf,
+                             double lower, double upper, double start,
+                             bool& throw_warning) {
+  
+  auto f = [&](double x) { return cdf(x) - p; };
+  double lo = lower, hi = upper;
+  double flo = NAN, fhi = NAN;
+  double x, fx, xnew, step, tol;
+  int maxit;
+  
+  x = start;
+  if (!(x > lo && x < hi)) {
+    if (R_FINITE(lo) && R_FINITE(hi))
+      x = (lo + hi)/2.0;
+    else if (R_FINITE(lo))
+      x = lo + std::max(1.0, std::abs(lo));
+    else if (R_FINITE(hi))
+      x = hi - std::max(1.0, std::abs(hi));
+    else
+      x = 0.0;
+  }
+  
+  for (int i = 0; i < INVCDF_MAXIT; i++) {
+    
+    fx = f(x);
+    if (fx == 0.0)
+      return x;
+    if (fx < 0.0) {
+      lo = x;
+      flo = fx;
+    } else {
+      hi = x;
+      fhi = fx;
+    }
+    
+    xnew = x - fx/pdf(x);
+    step = std::max(1.0, std::abs(x));
+    
+    if (hi == R_PosInf && !(xnew > x && xnew < x + step))
+      xnew = x + step;
+    else if (lo == R_NegInf && !(xnew < x && xnew > x - step))
+      xnew = x - step;
+    else if (!(xnew > lo && xnew < hi))
+      break;
+    
+    if (std::abs(xnew - x) <= INVCDF_TOL * std::abs(xnew))
+      return xnew;
+    x = xnew;
+  }
+  
+  if (!R_FINITE(lo) || !R_FINITE(hi)) {
+    throw_warning = true;
+    return NAN;
+  }
+  
+  if (ISNAN(flo))
+    flo = f(lo);
+  if (ISNAN(fhi))
+    fhi = f(hi);
+  if (!(flo <= 0.0 && fhi >= 0.0)) {
+    throw_warning = true;
+    return NAN;
+  }
+  
+  // if the bracket contains zero, rely on the relative
+  // machine precision tolerance of R_zeroin2
+  if (lo < 0.0 && hi > 0.0)
+    tol = 0.0;
+  else
+    tol = INVCDF_TOL * std::min(std::abs(lo), std::abs(hi));
+  maxit = INVCDF_MAXIT;
+  
+  x = R_zeroin2(lo, hi, flo, fhi, invcdf_zeroin_fn<decltype(f)>,
+                &f, &tol, &maxit);
+  if (maxit < 0) {
+    throw_warning = true;
+    return NAN;
+  }
+  return x;
+}
 
 #endif
 
@@ -0,0 +1,185 @@
+#ifndef EDCPP_KERNELS_H
+#define EDCPP_KERNELS_H
+
+#include <Rcpp.h>
+#include "shared.h"
+
+
+/*
+ *  Kernels of score functions, censored likelihoods and interval
+ *  probabilities, used by score-functions.cpp, censored-likelihoods.cpp
+ *  and interval-probabilities.cpp. Each distribution is described by
+ *  a single struct with:
+ *
+ *  npar    - number of parameters,
+ *  nscore  - number of parameters the derivatives are taken with respect
+ *            to (the first nscore parameters),
+ *  score   - log-density, writing the derivatives to grad,
+ *  logcens - log of f(x), 1-F(x) or F(x) depending on the censoring status,
+ *  logint  - log of P(lo < X <= hi),
+ *
+ *  where the kernels take pointer to the parameters and only those
+ *  available for the distribution are defined. The dispatch functions
+ *  list the distributions that have the respective kernel.
+ *
+ */
+
+
+// kernels defined in the distribution-specific files
+
+double score_gev(double x, double mu, double sigma, double xi, double* grad, bool& throw_warning);
+double score_gpd(double x, double mu, double sigma, double xi, double* grad, bool& throw_warning);
+double score_lomax(double x, double lambda, double kappa, double* grad, bool& throw_warning);
+double score_kumar(double x, double a, double b, double* grad, bool& throw_warning);
+double score_betapr(double x, double alpha, double beta, double sigma, double* grad, bool& throw_warning);
+double score_tnorm(double x, double mu, double sigma, double a, double b, double* grad, bool& throw_warning);
+double score_gompertz(double x, double a, double b, double* grad, bool& throw_warning);
+
+double logcens_tnorm(double x, double status, double mu, double sigma, double a, double b, bool& throw_warning);
+double logcens_gompertz(double x, double status, double a, double b, bool& throw_warning);
+double logcens_sgomp(double x, double status, double b, double eta, bool& throw_warning);
+double logcens_lomax(double x, double status, double lambda, double kappa, bool& throw_warning);
+
+double logint_tnorm(double lo, double hi, double mu, double sigma, double a, double b, bool& throw_warning);
+double logint_huber(double lo, double hi, double mu, double sigma, double c, bool& throw_warning);
+double logint_wald(double lo, double hi, double mu, double lambda, bool& throw_warning);
+
+
+struct kernels_gev {
+  static const int npar = 3;
+  static const int nscore = 3;
+  static double score(double x, const double* par, double* grad, bool& throw_warning) {
+    return score_gev(x, par[0], par[1], par[2], grad, throw_warning);
+  }
+};
+
+struct kernels_gpd {
+  static const int npar = 3;
+  static const int nscore = 3;
+  static double score(double x, const double* par, double* grad, bool& throw_warning) {
+    return score_gpd(x, par[0], par[1], par[2], grad, throw_warning);
+  }
+};
+
+struct kernels_lomax {
+  static const int npar = 2;
+  static const int nscore = 2;
+  static double score(double x, const double* par, double* grad, bool& throw_warning) {
+    return score_lomax(x, par[0], par[1], grad, throw_warning);
+  }
+  static double logcens(double x, double status, const double* par, bool& throw_warning) {
+    return logcens_lomax(x, status, par[0], par[1], throw_warning);
+  }
+};
+
+struct kernels_kumar {
+  static const int npar = 2;
+  static const int nscore = 2;
+  static double score(double x, const double* par, double* grad, bool& throw_warning) {
+    return score_kumar(x, par[0], par[1], grad, throw_warning);
+  }
+};
+
+struct kernels_betapr {
+  static const int npar = 3;
+  static const int nscore = 3;
+  static double score(double x, const double* par, double* grad, bool& throw_warning) {
+    return score_betapr(x, par[0], par[1], par[2], grad, throw_warning);
+  }
+};
+
+struct kernels_tnorm {
+  static const int npar = 4;
+  static const int nscore = 2;
+  static double score(double x, const double* par, double* grad, bool& throw_warning) {
+    return score_tnorm(x, par[0], par[1], par[2], par[3], grad, throw_warning);
+  }
+  static double logcens(double x, double status, const double* par, bool& throw_warning) {
+    return logcens_tnorm(x, status, par[0], par[1], par[2], par[3], throw_warning);
+  }
+  static double logint(double lo, double hi, const double* par, bool& throw_warning) {
+    return logint_tnorm(lo, hi, par[0], par[1], par[2], par[3], throw_warning);
+  }
+};
+
+struct kernels_gompertz {
+  static const int npar = 2;
+  static const int nscore = 2;
+  static double score(double x, const double* par, double* grad, bool& throw_warning) {
+    return score_gompertz(x, par[0], par[1], grad, throw_warning);
+  }
+  static double logcens(double x, double status, const double* par, bool& throw_warning) {
+    return logcens_gompertz(x, status, par[0], par[1], throw_warning);
+  }
+};
+
+struct kernels_sgomp {
+  static const int npar = 2;
+  static double logcens(double x, double status, const double* par, bool& throw_warning) {
+    return logcens_sgomp(x, status, par[0], par[1], throw_warning);
+  }
+};
+
+struct kernels_huber {
+  static const int npar = 3;
+  static double logint(double lo, double hi, const double* par, bool& throw_warning) {
+    return logint_huber(lo, hi, par[0], par[1], par[2], throw_warning);
+  }
+};
+
+struct kernels_wald {
+  static const int npar = 2;
+  static double logint(double lo, double hi, const double* par, bool& throw_warning) {
+    return logint_wald(lo, hi, par[0], par[1], throw_warning);
+  }
+};
+
+
+template <typename OP>
+inline auto dispatch_scores(const std::string& family, const OP& op)
+  -> decltype(op.template run<kernels_gev>()) {
+  if (family == "gev")
+    return op.template run<kernels_gev>();
+  if (family == "gpd")
+    return op.template run<kernels_gpd>();
+  if (family == "lomax")
+    return op.template run<kernels_lomax>();
+  if (family == "kumar")
+    return op.template run<kernels_kumar>();
+  if (family == "betapr")
+    return op.template run<kernels_betapr>();
+  if (family == "tnorm")
+    return op.template run<kernels_tnorm>();
+  if (family == "gompertz")
+    return op.template run<kernels_gompertz>();
+  Rcpp::stop("unknown family of distributions");
+}
+
+template <typename OP>
+inline auto dispatch_censored(const std::string& family, const OP& op)
+  -> decltype(op.template run<kernels_tnorm>()) {
+  if (family == "tnorm")
+    return op.template run<kernels_tnorm>();
+  if (family == "gompertz")
+    return op.template run<kernels_gompertz>();
+  if (family == "sgomp")
+    return op.template run<kernels_sgomp>();
+  if (family == "lomax")
+    return op.template run<kernels_lomax>();
+  Rcpp::stop("unknown family of distributions");
+}
+
+template <typename OP>
+inline auto dispatch_interval(const std::string& family, const OP& op)
+  -> decltype(op.template run<kernels_tnorm>()) {
+  if (family == "tnorm")
+    return op.template run<kernels_tnorm>();
+  if (family == "huber")
+    return op.template run<kernels_huber>();
+  if (family == "wald")
+    return op.template run<kernels_wald>();
+  Rcpp::stop("unknown family of distributions");
+}
+
+
+#endif
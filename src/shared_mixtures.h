@@ -0,0 +1,543 @@
+#ifndef EDCPP_MIXTURES_H
+#define EDCPP_MIXTURES_H
+
+#include <Rcpp.h>
+#include "shared.h"
+
+
+/*
+ *  Mixture densities
+ *
+ *  f(x) = sum_j alpha_j/sum(alpha) * f_j(x)
+ *
+ *  are computed on log scale,
+ *
+ *  log f(x) = m + log(sum_j exp(log(alpha_j/sum(alpha)) + log f_j(x) - m))
+ *
+ *  where m = max_j (log(alpha_j/sum(alpha)) + log f_j(x)), so the density
+ *  does not underflow far from the components. Consecutive values sharing
+ *  the same row of parameters are processed in blocks of MIX_BLOCK values:
+ *  parameters and mixing proportions are prepared once per block and the
+ *  component log-densities are computed component by component, with the
+ *  innermost loops running over the values of the block.
+ *
+ *  Posterior probabilities of the components (responsibilities)
+ *
+ *  r_j(x) = alpha_j/sum(alpha) * f_j(x) / f(x)
+ *
+ *  are obtained in the same pass.
+ *
+ */
+
+
+// number of values processed together
+
+static const int MIX_BLOCK = 256;
+
+
+// check if i-th and l-th value use the same rows of the parameter
+// matrices with given numbers of rows
+
+inline bool same_mix_row(int i, int l, const std::vector<int>& nrows) {
+  for (size_t m = 0; m < nrows.size(); m++) {
+    if (i % nrows[m] != l % nrows[m])
+      return false;
+  }
+  return true;
+}
+
+
+// normalized log mixing proportions for i-th row of alpha; returns false
+// if some of the proportions are negative or all of them are zero
+
+inline bool mix_log_weights(const Rcpp::NumericMatrix& alpha, int i,
+                            std::vector<double>& log_alpha, double& nans_sum) {
+
+  int k = alpha.ncol();
+  double alpha_tot = 0.0;
+  bool valid = true;
+
+  for (int j = 0; j < k; j++) {
+    if (GETM(alpha, i, j) < 0.0)
+      valid = false;
+    alpha_tot += GETM(alpha, i, j);
+  }
+
+  nans_sum += alpha_tot;
+
+  if (!valid || alpha_tot <= 0.0 || ISNAN(alpha_tot))
+    return false;
+
+  for (int j = 0; j < k; j++)
+    log_alpha[j] = std::log(GETM(alpha, i, j) / alpha_tot);
+
+  return true;
+}
+
+
+// Log-density of the mixture, written to p. The functors are:
+//
+//   bool prepare(int i, double& nans_sum) - loads the parameters
+//     of components for i-th value, adds them to nans_sum and returns
+//     false if they are not valid;
+//   bool support(double x) - returns false if x is outside of the
+//     support of all the components (log-density is -Inf);
+//   double logpdf(double x, int j) - log-density of j-th component.
+//
+// nrows are the numbers of rows of all the parameter matrices (including
+// alpha). If resp is not NULL, the Nmax x k matrix of responsibilities
+// is written there (column-wise). x is an integer or a double vector.
+
+template <typename T, typename PREP, typename SUPP, typename LPDF>
+inline void mixture_logpdf(const T& x, int Nmax,
+                           const Rcpp::NumericMatrix& alpha,
+                           const std::vector<int>& nrows,
+                           PREP prepare, SUPP support, LPDF logpdf,
+                           Rcpp::NumericVector& p, double* resp,
+                           bool& throw_warning) {
+
+  int k = alpha.ncol();
+  int nb, end;
+  bool valid = false;
+  double nans_sum = 0.0, xi, m, s;
+
+  std::vector<double> log_alpha(k);
+  std::vector<double> xb(MIX_BLOCK);
+  std::vector<double> lp(MIX_BLOCK * k);
+  std::vector<double> mx(MIX_BLOCK);
+  std::vector<double> sm(MIX_BLOCK);
+  std::vector<bool> skip(MIX_BLOCK);
+
+  for (int start = 0; start < Nmax; start = end) {
+
+    Rcpp::checkUserInterrupt();
+
+    // parameters are prepared only if they differ from
+    // those used for the previous block
+
+    if (start == 0 || !same_mix_row(start, start-1, nrows)) {
+      nans_sum = 0.0;
+      valid = mix_log_weights(alpha, start, log_alpha, nans_sum);
+      valid = prepare(start, nans_sum) && valid;
+    }
+
+    end = start + 1;
+    while (end < Nmax && end - start < MIX_BLOCK &&
+           same_mix_row(end, start, nrows))
+      end++;
+    nb = end - start;
+
+    for (int b = 0; b < nb; b++) {
+      xi = as_dbl(GETV(x, start + b));
+      skip[b] = true;
+      if (ISNAN(xi + nans_sum)) {
+        p[start + b] = xi + nans_sum;
+      } else if (!valid) {
+        throw_warning = true;
+        p[start + b] = NAN;
+      } else if (!support(xi)) {
+        p[start + b] = R_NegInf;
+      } else {
+        skip[b] = false;
+      }
+      xb[b] = skip[b] ? 0.0 : xi;
+    }
+
+    if (valid) {
+
+      for (int j = 0; j < k; j++) {
+        for (int b = 0; b < nb; b++)
+          lp[j*MIX_BLOCK + b] = log_alpha[j] + logpdf(xb[b], j);
+      }
+
+      for (int b = 0; b < nb; b++)
+        mx[b] = lp[b];
+      for (int j = 1; j < k; j++) {
+        for (int b = 0; b < nb; b++)
+          mx[b] = std::max(mx[b], lp[j*MIX_BLOCK + b]);
+      }
+
+      for (int b = 0; b < nb; b++)
+        sm[b] = 0.0;
+      for (int j = 0; j < k; j++) {
+        for (int b = 0; b < nb; b++)
+          sm[b] += std::exp(lp[j*MIX_BLOCK + b] - mx[b]);
+      }
+
+      for (int b = 0; b < nb; b++) {
+        if (skip[b])
+          continue;
+        m = mx[b];
+        p[start + b] = R_FINITE(m) ? m + std::log(sm[b]) : m;
+      }
+    }
+
+    if (resp == NULL)
+      continue;
+
+    for (int j = 0; j < k; j++) {
+      for (int b = 0; b < nb; b++) {
+        s = p[start + b];
+        if (skip[b] || !valid || !R_FINITE(s))
+          resp[j*Nmax + start + b] = ISNAN(s) ? s : NAN;
+        else
+          resp[j*Nmax + start + b] = std::exp(lp[j*MIX_BLOCK + b] - s);
+      }
+    }
+  }
+}
+
+
+// Parameters of the components for i-th value, stored as par[j*npar + m]
+// for the m-th parameter of the j-th component of family F; returns false
+// if some of them are not valid
+
+template <typename F>
+inline bool mix_params(const std::vector<Rcpp::NumericMatrix>& params,
+                       int i, int k, std::vector<double>& par,
+                       double& nans_sum) {
+  bool valid = true;
+  for (int j = 0; j < k; j++) {
+    for (int m = 0; m < F::npar; m++) {
+      par[j*F::npar + m] = GETM(params[m], i, j);
+      nans_sum += par[j*F::npar + m];
+    }
+    if (!F::valid(&par[j*F::npar]))
+      valid = false;
+  }
+  return valid;
+}
+
+
+// numbers of rows of the parameter matrices and alpha, throws an error
+// if the numbers of components do not match
+
+template <typename F>
+inline std::vector<int> mix_nrows(const std::vector<Rcpp::NumericMatrix>& params,
+                                  const Rcpp::NumericMatrix& alpha) {
+  std::vector<int> nrows;
+  if (static_cast<int>(params.size()) != F::npar)
+    Rcpp::stop("wrong number of parameters");
+  for (int m = 0; m < F::npar; m++) {
+    if (params[m].ncol() != alpha.ncol())
+      Rcpp::stop("sizes of parameters and alpha do not match");
+    nrows.push_back(params[m].nrow());
+  }
+  nrows.push_back(alpha.nrow());
+  return nrows;
+}
+
+
+inline int mix_length(int n, const std::vector<int>& nrows) {
+  for (size_t m = 0; m < nrows.size(); m++)
+    n = std::max(n, nrows[m]);
+  return n;
+}
+
+
+inline bool mix_empty(int n, const std::vector<int>& nrows) {
+  for (size_t m = 0; m < nrows.size(); m++) {
+    if (nrows[m] < 1)
+      return true;
+  }
+  return n < 1;
+}
+
+
+// Density of the mixture of components from family F
+
+template <typename F>
+inline Rcpp::NumericVector mixture_pdf(const Rcpp::NumericVector& x,
+                                       const std::vector<Rcpp::NumericMatrix>& params,
+                                       const Rcpp::NumericMatrix& alpha,
+                                       bool log_prob, bool responsibilities) {
+  
+  std::vector<int> nrows = mix_nrows<F>(params, alpha);
+  int Nmax = mix_length(x.length(), nrows);
+  int k = alpha.ncol();
+  
+  if (mix_empty(x.length(), nrows))
+    return Rcpp::NumericVector(0);
+  
+  Rcpp::NumericVector p(Nmax);
+  Rcpp::NumericMatrix resp(responsibilities ? Nmax : 0, responsibilities ? k : 0);
+  std::vector<double> par(k * F::npar);
+  bool throw_warning = false;
+  
+  mixture_logpdf(x, Nmax, alpha, nrows,
+    [&](int i, double& nans_sum) {
+      return mix_params<F>(params, i, k, par, nans_sum);
+    },
+    [](double xi) {
+      return !F::discrete || isInteger(xi);
+    },
+    [&](double xi, int j) {
+      return F::logpdf(xi, &par[j*F::npar], throw_warning);
+    },
+    p, responsibilities ? resp.begin() : NULL, throw_warning);
+  
+  if (!log_prob)
+    p = Rcpp::exp(p);
+  
+  if (responsibilities)
+    p.attr("responsibilities") = resp;
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// Distribution function of the mixture of components from family F
+
+template <typename F, typename T>
+inline Rcpp::NumericVector mixture_cdf(const T& x,
+                                       const std::vector<Rcpp::NumericMatrix>& params,
+                                       const Rcpp::NumericMatrix& alpha,
+                                       bool lower_tail, bool log_prob) {
+  
+  std::vector<int> nrows = mix_nrows<F>(params, alpha);
+  int Nmax = mix_length(x.length(), nrows);
+  int k = alpha.ncol();
+  
+  if (mix_empty(x.length(), nrows))
+    return Rcpp::NumericVector(0);
+  
+  Rcpp::NumericVector p(Nmax);
+  std::vector<double> par(k * F::npar), log_alpha(k), w(k);
+  bool throw_warning = false, valid = false;
+  double nans_sum = 0.0, xi;
+  
+  for (int i = 0; i < Nmax; i++) {
+  
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+  
+    if (i == 0 || !same_mix_row(i, i-1, nrows)) {
+      nans_sum = 0.0;
+      valid = mix_log_weights(alpha, i, log_alpha, nans_sum);
+      valid = mix_params<F>(params, i, k, par, nans_sum) && valid;
+      for (int j = 0; j < k; j++)
+        w[j] = std::exp(log_alpha[j]);
+    }
+  
+    xi = as_dbl(GETV(x, i));
+  
+    if (ISNAN(xi + nans_sum)) {
+      p[i] = xi + nans_sum;
+      continue;
+    }
+  
+    if (!valid) {
+      throw_warning = true;
+      p[i] = NAN;
+      continue;
+    }
+  
+    p[i] = 0.0;
+    for (int j = 0; j < k; j++) {
+      if (w[j] > 0.0)
+        p[i] += w[j] * F::cdf(xi, &par[j*F::npar], throw_warning);
+    }
+  }
+  
+  if (!lower_tail)
+    p = 1.0 - p;
+  
+  if (log_prob)
+    p = Rcpp::log(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// Quantile function of the mixture of components from family F. The
+// quantile lies between the smallest and the largest quantiles of the
+// components; continuous distributions are inverted numerically, for
+// discrete ones the bracket is bisected over integers.
+
+template <typename F>
+inline Rcpp::NumericVector mixture_invcdf(const Rcpp::NumericVector& p,
+                                          const std::vector<Rcpp::NumericMatrix>& params,
+                                          const Rcpp::NumericMatrix& alpha,
+                                          bool lower_tail, bool log_prob) {
+  
+  std::vector<int> nrows = mix_nrows<F>(params, alpha);
+  int Nmax = mix_length(p.length(), nrows);
+  int k = alpha.ncol();
+  
+  if (mix_empty(p.length(), nrows))
+    return Rcpp::NumericVector(0);
+  
+  Rcpp::NumericVector x(Nmax);
+  Rcpp::NumericVector pp = Rcpp::clone(p);
+  std::vector<double> par(k * F::npar), log_alpha(k), w(k);
+  bool throw_warning = false, valid = false;
+  double nans_sum = 0.0, pi, qj, lo, hi, mid, start;
+  
+  if (log_prob)
+    pp = Rcpp::exp(pp);
+  
+  if (!lower_tail)
+    pp = 1.0 - pp;
+  
+  auto cdf = [&](double xi) {
+    double p_tmp = 0.0;
+    for (int j = 0; j < k; j++) {
+      if (w[j] > 0.0)
+        p_tmp += w[j] * F::cdf(xi, &par[j*F::npar], throw_warning);
+    }
+    return p_tmp;
+  };
+  
+  auto pdf = [&](double xi) {
+    double d_tmp = 0.0;
+    for (int j = 0; j < k; j++) {
+      if (w[j] > 0.0)
+        d_tmp += w[j] * std::exp(F::logpdf(xi, &par[j*F::npar], throw_warning));
+    }
+    return d_tmp;
+  };
+  
+  for (int i = 0; i < Nmax; i++) {
+  
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+  
+    if (i == 0 || !same_mix_row(i, i-1, nrows)) {
+      nans_sum = 0.0;
+      valid = mix_log_weights(alpha, i, log_alpha, nans_sum);
+      valid = mix_params<F>(params, i, k, par, nans_sum) && valid;
+      for (int j = 0; j < k; j++)
+        w[j] = std::exp(log_alpha[j]);
+    }
+  
+    pi = GETV(pp, i);
+  
+    if (ISNAN(pi + nans_sum)) {
+      x[i] = pi + nans_sum;
+      continue;
+    }
+  
+    if (!valid || !VALID_PROB(pi)) {
+      throw_warning = true;
+      x[i] = NAN;
+      continue;
+    }
+  
+    lo = R_PosInf;
+    hi = R_NegInf;
+    start = 0.0;
+  
+    for (int j = 0; j < k; j++) {
+      if (w[j] == 0.0)
+        continue;
+      qj = F::invcdf(pi, &par[j*F::npar], throw_warning);
+      lo = std::min(lo, qj);
+      hi = std::max(hi, qj);
+      start += w[j] * qj;
+    }
+  
+    if (lo == hi || pi == 0.0 || pi == 1.0) {
+      x[i] = (pi == 1.0) ? hi : lo;
+      continue;
+    }
+  
+    if (F::discrete) {
+      while (lo < hi) {
+        mid = std::floor((lo + hi)/2.0);
+        if (cdf(mid) >= pi)
+          hi = mid;
+        else
+          lo = mid + 1.0;
+      }
+      x[i] = lo;
+      continue;
+    }
+  
+    // warm start at the previous quantile if it is inside the bracket
+    if (i > 0 && x[i-1] > lo && x[i-1] < hi)
+      start = x[i-1];
+  
+    x[i] = invcdf_numeric(pi, cdf, pdf, lo, hi, start, throw_warning);
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return x;
+}
+
+
+// Random generation from the mixture of components from family F: the
+// component is chosen by inverting the cumulative mixing proportions,
+// then a value is drawn from it. The i-th value is passed to store(i, x),
+// so that discrete families can keep them as integers (see int_values).
+// The caller checks with mix_empty that there is anything to draw.
+
+template <typename F, typename STORE>
+inline void mixture_rng_values(int n,
+                               const std::vector<Rcpp::NumericMatrix>& params,
+                               const Rcpp::NumericMatrix& alpha,
+                               STORE store) {
+  
+  std::vector<int> nrows = mix_nrows<F>(params, alpha);
+  int k = alpha.ncol();
+  
+  std::vector<double> par(k * F::npar), log_alpha(k), cum(k);
+  bool throw_warning = false, valid = false;
+  double nans_sum = 0.0, u;
+  int jj;
+  
+  for (int i = 0; i < n; i++) {
+  
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+  
+    if (i == 0 || !same_mix_row(i, i-1, nrows)) {
+      nans_sum = 0.0;
+      valid = mix_log_weights(alpha, i, log_alpha, nans_sum);
+      valid = mix_params<F>(params, i, k, par, nans_sum) && valid;
+      for (int j = 0; j < k; j++)
+        cum[j] = (j > 0 ? cum[j-1] : 0.0) + std::exp(log_alpha[j]);
+    }
+  
+    if (ISNAN(nans_sum) || !valid) {
+      throw_warning = true;
+      store(i, NA_REAL);
+      continue;
+    }
+  
+    u = rng_unif() * cum[k-1];
+    jj = 0;
+    while (jj < k-1 && (u >= cum[jj] || log_alpha[jj] == R_NegInf))
+      jj++;
+  
+    store(i, F::rng(&par[jj*F::npar], throw_warning));
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NAs produced");
+}
+
+template <typename F>
+inline Rcpp::NumericVector mixture_rng(int n,
+                                       const std::vector<Rcpp::NumericMatrix>& params,
+                                       const Rcpp::NumericMatrix& alpha) {
+  
+  if (mix_empty(n, mix_nrows<F>(params, alpha)))
+    return Rcpp::NumericVector(0);
+  
+  Rcpp::NumericVector x(n);
+  mixture_rng_values<F>(n, params, alpha,
+                        [&](int i, double xi) { x[i] = xi; });
+  
+  return x;
+}
+
+
+#endif
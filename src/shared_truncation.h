@@ -0,0 +1,410 @@
+#ifndef EDCPP_TRUNCATION_H
+#define EDCPP_TRUNCATION_H
+
+#include <Rcpp.h>
+#include "shared.h"
+
+
+/*
+ *  Distributions truncated to (a, b]
+ *
+ *  f(x) = g(x) / (G(b) - G(a))
+ *  F(x) = (G(x) - G(a)) / (G(b) - G(a))
+ *  F^-1(p) = G^-1(G(a) + p*(G(b) - G(a)))
+ *
+ *  where g, G are the density and distribution function of the family.
+ *  For discrete families the support starts at the first integer larger
+ *  than a, as in the truncated Poisson and binomial distributions.
+ *
+ *  If a is above the median of the family, G(a) and G(b) may round to 1,
+ *  so the upper tail probabilities S(x) = 1 - G(x) are used on log scale:
+ *
+ *  f(x) = g(x) / (S(a) - S(b))
+ *  F(x) = 1 - (S(x) - S(b)) / (S(a) - S(b))
+ *  F^-1(p) = S^-1(S(a) - p*(S(a) - S(b)))
+ *
+ *  G(a) and G(b) are computed once per unique combination of parameters
+ *  and truncation points: they are reused for consecutive values sharing
+ *  the same parameters and, when the parameters are recycled, memoized.
+ *
+ */
+
+
+// random values are drawn by rejection (drawing from the family until the
+// value falls in the truncation interval) if the quantile function is not
+// given in closed form and the probability of acceptance is at least
+// TRUNC_REJECT_MASS, otherwise by inversion
+
+static const double TRUNC_REJECT_MASS = 0.25;
+
+// maximal number of rejected draws before falling back to inversion
+
+static const int TRUNC_REJECT_MAXIT = 1000;
+
+
+// G(a) and G(b), or log(S(a)) and log(S(b)) if upper is true,
+// and the log of the truncation mass
+
+struct trunc_mass {
+  double ga, gb, lmass;
+  bool upper;
+};
+
+
+// Parameters and the truncation mass for the i-th value
+
+template <typename F>
+class trunc_rows {
+  
+  const std::vector<Rcpp::NumericVector>& params;
+  const Rcpp::NumericVector& lower;
+  const Rcpp::NumericVector& upper;
+  std::map<std::vector<int>, trunc_mass> memo;
+  std::vector<int> key, last;
+  bool memoize;
+  
+public:
+  
+  double par[F::npar];
+  double a, b, nans_sum;
+  trunc_mass m;
+  bool valid;
+  
+  trunc_rows(const std::vector<Rcpp::NumericVector>& params_,
+             const Rcpp::NumericVector& lower_,
+             const Rcpp::NumericVector& upper_,
+             int n)
+    : params(params_), lower(lower_), upper(upper_), key(F::npar + 2) {
+  
+    if (static_cast<int>(params.size()) != F::npar)
+      Rcpp::stop("wrong number of parameters");
+  
+    int Npar = std::max(lower.length(), upper.length());
+    for (int m = 0; m < F::npar; m++)
+      Npar = std::max(Npar, static_cast<int>(params[m].length()));
+    memoize = length(n) > Npar;
+  }
+  
+  int length(int n) const {
+    n = std::max({ n, static_cast<int>(lower.length()),
+                   static_cast<int>(upper.length()) });
+    for (int m = 0; m < F::npar; m++)
+      n = std::max(n, static_cast<int>(params[m].length()));
+    return n;
+  }
+  
+  bool empty(int n) const {
+    for (int m = 0; m < F::npar; m++) {
+      if (params[m].length() < 1)
+        return true;
+    }
+    return n < 1 || lower.length() < 1 || upper.length() < 1;
+  }
+  
+  // loads the parameters for the i-th value; valid is false if the
+  // parameters are not valid or the truncation interval has zero mass
+  
+  void load(int i, bool& throw_warning) {
+  
+    for (int m = 0; m < F::npar; m++)
+      key[m] = i % params[m].length();
+    key[F::npar] = i % lower.length();
+    key[F::npar + 1] = i % upper.length();
+  
+    if (i > 0 && key == last)
+      return;
+    last = key;
+  
+    nans_sum = 0.0;
+    for (int m = 0; m < F::npar; m++) {
+      par[m] = params[m][key[m]];
+      nans_sum += par[m];
+    }
+    a = lower[key[F::npar]];
+    b = upper[key[F::npar + 1]];
+    nans_sum += a + b;
+  
+    valid = !ISNAN(nans_sum) && F::valid(par) && a < b;
+    if (!valid)
+      return;
+  
+    if (memoize) {
+      auto it = memo.find(key);
+      if (it == memo.end())
+        it = memo.insert(std::make_pair(key, mass(throw_warning))).first;
+      m = it->second;
+    } else {
+      m = mass(throw_warning);
+    }
+  
+    valid = m.lmass > R_NegInf;
+  }
+  
+  trunc_mass mass(bool& throw_warning) const {
+    trunc_mass t;
+    t.ga = (a == R_NegInf) ? 0.0 : F::cdf(a, par, throw_warning);
+    t.upper = t.ga > 0.5;
+    if (t.upper) {
+      t.ga = F::logccdf(a, par, throw_warning);
+      t.gb = (b == R_PosInf) ? R_NegInf : F::logccdf(b, par, throw_warning);
+      t.lmass = log_sub_exp(t.ga, t.gb);
+    } else {
+      t.gb = (b == R_PosInf) ? 1.0 : F::cdf(b, par, throw_warning);
+      t.lmass = (t.gb > t.ga) ? std::log(t.gb - t.ga) : R_NegInf;
+    }
+    return t;
+  }
+  
+  // is x in the support of the truncated distribution
+  
+  bool inside(double x) const {
+    return x > a && x <= b && (!F::discrete || isInteger(x, false));
+  }
+  
+  // distribution function of the truncated distribution for a < x < b
+  
+  double cdf(double x, bool& throw_warning) const {
+    double p;
+    if (m.upper)
+      p = -std::expm1(log_sub_exp(F::logccdf(x, par, throw_warning), m.gb) - m.lmass);
+    else
+      p = (F::cdf(x, par, throw_warning) - m.ga) / (m.gb - m.ga);
+    return std::min(std::max(p, 0.0), 1.0);
+  }
+  
+  // quantile of the truncated distribution for 0 <= p <= 1
+  
+  double invcdf(double p, bool& throw_warning) const {
+    double q;
+    if (m.upper) {
+      // the fuzz of the discrete quantile functions of R, against
+      // rounding errors of 1-p when p is computed by the cdf
+      if (F::discrete && p < 1.0)
+        p *= 1.0 - 64.0 * DBL_EPSILON;
+      q = F::invlogccdf(log_sub_exp(m.ga, std::log(p) + m.lmass), par, throw_warning);
+    } else {
+      q = F::invcdf(m.ga + p * (m.gb - m.ga), par, throw_warning);
+    }
+    if (F::discrete) {
+      q = std::max(q, std::floor(a) + 1.0);
+      q = std::min(q, std::floor(b));
+    } else {
+      q = std::max(q, a);
+      q = std::min(q, b);
+    }
+    return q;
+  }
+  
+};
+
+
+// Density of the truncated distribution from family F
+
+template <typename F>
+inline Rcpp::NumericVector truncated_pdf(const Rcpp::NumericVector& x,
+                                         const std::vector<Rcpp::NumericVector>& params,
+                                         const Rcpp::NumericVector& lower,
+                                         const Rcpp::NumericVector& upper,
+                                         bool log_prob) {
+  
+  trunc_rows<F> rows(params, lower, upper, x.length());
+  
+  if (rows.empty(x.length()))
+    return Rcpp::NumericVector(0);
+  
+  int Nmax = rows.length(x.length());
+  Rcpp::NumericVector p(Nmax);
+  bool throw_warning = false;
+  double xi;
+  
+  for (int i = 0; i < Nmax; i++) {
+  
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+  
+    rows.load(i, throw_warning);
+    xi = GETV(x, i);
+  
+    if (ISNAN(xi + rows.nans_sum)) {
+      p[i] = xi + rows.nans_sum;
+    } else if (!rows.valid) {
+      throw_warning = true;
+      p[i] = NAN;
+    } else if (!rows.inside(xi)) {
+      p[i] = R_NegInf;
+    } else {
+      p[i] = F::logpdf(xi, rows.par, throw_warning) - rows.m.lmass;
+    }
+  }
+  
+  if (!log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// Distribution function of the truncated distribution from family F
+
+template <typename F>
+inline Rcpp::NumericVector truncated_cdf(const Rcpp::NumericVector& x,
+                                         const std::vector<Rcpp::NumericVector>& params,
+                                         const Rcpp::NumericVector& lower,
+                                         const Rcpp::NumericVector& upper,
+                                         bool lower_tail, bool log_prob) {
+  
+  trunc_rows<F> rows(params, lower, upper, x.length());
+  
+  if (rows.empty(x.length()))
+    return Rcpp::NumericVector(0);
+  
+  int Nmax = rows.length(x.length());
+  Rcpp::NumericVector p(Nmax);
+  bool throw_warning = false;
+  double xi;
+  
+  for (int i = 0; i < Nmax; i++) {
+  
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+  
+    rows.load(i, throw_warning);
+    xi = GETV(x, i);
+  
+    if (ISNAN(xi + rows.nans_sum)) {
+      p[i] = xi + rows.nans_sum;
+    } else if (!rows.valid) {
+      throw_warning = true;
+      p[i] = NAN;
+    } else if (xi <= rows.a) {
+      p[i] = 0.0;
+    } else if (xi >= rows.b) {
+      p[i] = 1.0;
+    } else {
+      p[i] = rows.cdf(xi, throw_warning);
+    }
+  }
+  
+  if (!lower_tail)
+    p = 1.0 - p;
+  
+  if (log_prob)
+    p = Rcpp::log(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// Quantile function of the truncated distribution from family F
+
+template <typename F>
+inline Rcpp::NumericVector truncated_invcdf(const Rcpp::NumericVector& p,
+                                            const std::vector<Rcpp::NumericVector>& params,
+                                            const Rcpp::NumericVector& lower,
+                                            const Rcpp::NumericVector& upper,
+                                            bool lower_tail, bool log_prob) {
+  
+  trunc_rows<F> rows(params, lower, upper, p.length());
+  
+  if (rows.empty(p.length()))
+    return Rcpp::NumericVector(0);
+  
+  int Nmax = rows.length(p.length());
+  Rcpp::NumericVector x(Nmax);
+  Rcpp::NumericVector pp = Rcpp::clone(p);
+  bool throw_warning = false;
+  double pi;
+  
+  if (log_prob)
+    pp = Rcpp::exp(pp);
+  
+  if (!lower_tail)
+    pp = 1.0 - pp;
+  
+  for (int i = 0; i < Nmax; i++) {
+  
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+  
+    rows.load(i, throw_warning);
+    pi = GETV(pp, i);
+  
+    if (ISNAN(pi + rows.nans_sum)) {
+      x[i] = pi + rows.nans_sum;
+    } else if (!rows.valid || !VALID_PROB(pi)) {
+      throw_warning = true;
+      x[i] = NAN;
+    } else {
+      x[i] = rows.invcdf(pi, throw_warning);
+    }
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return x;
+}
+
+
+// Random generation from the truncated distribution from family F
+
+template <typename F>
+inline Rcpp::NumericVector truncated_rng(int n,
+                                         const std::vector<Rcpp::NumericVector>& params,
+                                         const Rcpp::NumericVector& lower,
+                                         const Rcpp::NumericVector& upper) {
+  
+  trunc_rows<F> rows(params, lower, upper, n);
+  
+  if (rows.empty(n))
+    return Rcpp::NumericVector(0);
+  
+  Rcpp::NumericVector x(n);
+  bool throw_warning = false, reject;
+  double xi;
+  int iter;
+  
+  for (int i = 0; i < n; i++) {
+  
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+  
+    rows.load(i, throw_warning);
+  
+    if (!rows.valid) {
+      throw_warning = true;
+      x[i] = NA_REAL;
+      continue;
+    }
+  
+    reject = !F::fast_invcdf && rows.m.lmass >= std::log(TRUNC_REJECT_MASS);
+  
+    if (reject) {
+      for (iter = 0; iter < TRUNC_REJECT_MAXIT; iter++) {
+        xi = F::rng(rows.par, throw_warning);
+        if (rows.inside(xi))
+          break;
+      }
+      if (iter < TRUNC_REJECT_MAXIT) {
+        x[i] = xi;
+        continue;
+      }
+    }
+  
+    x[i] = rows.invcdf(rng_unif(), throw_warning);
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NAs produced");
+  
+  return x;
+}
+
+
+#endif
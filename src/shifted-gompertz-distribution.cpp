@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_kernels.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -74,6 +75,26 @@ inline double cdf_sgomp(double x, double b, double eta,
   return (1-ebx) * exp(-eta*ebx);
 }
 
+inline double invcdf_sgomp(double p, double b, double eta,
+                           double start, bool& throw_warning) {
+  if (ISNAN(p) || ISNAN(b) || ISNAN(eta))
+    return p+b+eta;
+  if (b <= 0.0 || eta <= 0.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (p == 0.0)
+    return 0.0;
+  if (p == 1.0)
+    return R_PosInf;
+  if (ISNAN(start))
+    start = -log(1.0 - p)/b;
+  return invcdf_numeric(p,
+    [&](double x) { return cdf_sgomp(x, b, eta, throw_warning); },
+    [&](double x) { return pdf_sgomp(x, b, eta, throw_warning); },
+    0.0, R_PosInf, start, throw_warning);
+}
+
 inline double rng_sgomp(double b, double eta, bool& throw_warning) {
   if (ISNAN(b) || ISNAN(eta) || b <= 0.0 || eta <= 0.0) {
     throw_warning = true;
@@ -86,6 +107,31 @@ inline double rng_sgomp(double b, double eta, bool& throw_warning) {
   return (rg>re) ? rg : re;
 }
 
+// log f(x) (status = 1), log(1-F(x)) (status = 0) or log F(x)
+// (status = 2), sharing exp(-b*x)
+
+double logcens_sgomp(double x, double status, double b, double eta,
+                     bool& throw_warning) {
+  if (ISNAN(x) || ISNAN(status) || ISNAN(b) || ISNAN(eta))
+    return x+status+b+eta;
+  if (b <= 0.0 || eta <= 0.0 || (status != 0.0 && status != 1.0 && status != 2.0)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0)
+    return (status == 0.0) ? 0.0 : R_NegInf;
+  if (!R_FINITE(x))
+    return (status == 2.0) ? 0.0 : R_NegInf;
+  double ebx = exp(-b*x);
+  if (status == 1.0)
+    return log(b) - b*x - eta*ebx + log1p(eta*(1.0-ebx));
+  double lF = log1p(-ebx) - eta*ebx;
+  if (status == 2.0)
+    return lF;
+  else
+    return log(-expm1(lF));
+}
+
 
 // [[Rcpp::export]]
 NumericVector cpp_dsgomp(
@@ -153,6 +199,51 @@ NumericVector cpp_psgomp(
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_qsgomp(
+    const NumericVector& p,
+    const NumericVector& b,
+    const NumericVector& eta,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  int Nmax = std::max({
+    p.length(),
+    b.length(),
+    eta.length()
+  });
+  NumericVector x(Nmax);
+  NumericVector pp = Rcpp::clone(p);
+  
+  bool throw_warning = false;
+  double start;
+  
+  if (log_prob)
+    pp = Rcpp::exp(pp);
+  
+  if (!lower_tail)
+    pp = 1.0 - pp;
+  
+  for (int i = 0; i < Nmax; i++) {
+    // warm start at the previous quantile if parameters are unchanged
+    if (i > 0 && GETV(b, i) == GETV(b, i-1) &&
+        GETV(eta, i) == GETV(eta, i-1))
+      start = x[i-1];
+    else
+      start = NAN;
+    x[i] = invcdf_sgomp(GETV(pp, i), GETV(b, i),
+                        GETV(eta, i), start,
+                        throw_warning);
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return x;
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_rsgomp(
     const int& n,
@@ -20,18 +20,179 @@ using Rcpp::NumericVector;
  * 
  */
 
-inline double pmf_skellam(double x, double mu1, double mu2,
-                          bool& throw_warning) {
+inline double logpmf_skellam(double x, double mu1, double mu2,
+                             bool& throw_warning, bool int_x = false) {
   if (ISNAN(x) || ISNAN(mu1) || ISNAN(mu2))
     return x+mu1+mu2;
   if (mu1 < 0.0 || mu2 < 0.0) {
     throw_warning = true;
     return NAN;
   }
-  if (!isInteger(x) || !R_FINITE(x))
-    return 0.0;
-  return exp(-(mu1+mu2)) * pow(mu1/mu2, x/2.0) *
-    R::bessel_i(2.0*sqrt(mu1*mu2), x, 1.0);
+  if ((!int_x && !isInteger(x)) || !R_FINITE(x))
+    return R_NegInf;
+  if (mu1 == 0.0 && mu2 == 0.0)
+    return (x == 0.0) ? 0.0 : R_NegInf;
+  if (mu2 == 0.0)
+    return R::dpois(x, mu1, true);
+  if (mu1 == 0.0)
+    return R::dpois(-x, mu2, true);
+  // exp(-(mu1+mu2)) * I(z) == exp(-(sqrt(mu1)-sqrt(mu2))^2) * exp(-z)*I(z)
+  double z = 2.0*sqrt(mu1*mu2);
+  return -pow(sqrt(mu1) - sqrt(mu2), 2.0) + (x/2.0) * (log(mu1) - log(mu2)) +
+    log(R::bessel_i(z, abs(x), 2.0));
+}
+
+// Log-probabilities for x = lo, ..., hi. Only a single probability
+// (the anchor, closest to the mean) is evaluated using the Bessel
+// function, the remaining ones follow from the ratios of neighbouring
+// probabilities given by the three-term recurrence
+//
+//   mu2*f(x+1) + x*f(x) - mu1*f(x-1) = 0
+//
+// The ratios f(x+1)/f(x) for x >= 0 are computed by backward recursion
+// started in the far right tail and the ratios f(x-1)/f(x) for x <= 0
+// by forward recursion started in the far left tail (Miller's
+// algorithm); in both directions only positive terms are added.
+
+// extra terms needed for the recursions to forget their starting values
+
+inline double skellam_extra(double mu1, double mu2) {
+  return 30.0 + ceil(8.0 * sqrt(2.0*sqrt(mu1*mu2)));
+}
+
+inline std::vector<double> logpmf_skellam_table(int lo, int hi,
+                                                double mu1, double mu2) {
+  
+  if (lo > hi || mu1 < 0.0 || mu2 < 0.0)
+    Rcpp::stop("inadmissible values");
+  
+  int n = hi - lo + 1;
+  std::vector<double> l_tab(n);
+  std::vector<double> lr(n);   // log f(k+1)/f(k) for k = lo, ..., hi-1
+  bool throw_warning = false;
+  double r, dj;
+  int j, a;
+  
+  int extra = static_cast<int>(skellam_extra(mu1, mu2));
+  
+  if (hi > 0) {
+    r = 0.0;
+    for (j = std::max(hi, 0) + extra; j > std::max(lo, 0); j--) {
+      dj = to_dbl(j);
+      r = mu1/(mu2*r + dj);          // f(j)/f(j-1)
+      if (j-1 < hi)
+        lr[j-1-lo] = log(r);
+    }
+  }
+  
+  if (lo < 0) {
+    r = 0.0;
+    for (j = std::min(lo, 0) - extra; j < std::min(hi, 0); j++) {
+      dj = to_dbl(j);
+      r = mu2/(mu1*r - dj);          // f(j)/f(j+1)
+      if (j >= lo)
+        lr[j-lo] = -log(r);
+    }
+  }
+  
+  a = static_cast<int>(std::round(mu1 - mu2));
+  a = std::min(std::max(a, lo), hi);
+  
+  l_tab[a-lo] = logpmf_skellam(to_dbl(a), mu1, mu2, throw_warning);
+  
+  if (l_tab[a-lo] == R_NegInf) {
+    std::fill(l_tab.begin(), l_tab.end(), R_NegInf);
+    return l_tab;
+  }
+  
+  for (j = a; j < hi; j++)
+    l_tab[j+1-lo] = l_tab[j-lo] + lr[j-lo];
+  for (j = a-1; j >= lo; j--)
+    l_tab[j-lo] = l_tab[j+1-lo] - lr[j-lo];
+  
+  return l_tab;
+}
+
+// Cumulative probabilities for x = lo, ..., hi, where lo and hi are
+// 20 standard deviations (plus 20) away from the mean, so that the
+// probability mass outside [lo, hi] is negligible.
+
+inline void skellam_range(double mu1, double mu2, int& lo, int& hi) {
+  double sd = sqrt(mu1 + mu2);
+  double int_max = to_dbl(std::numeric_limits<int>::max());
+  lo = static_cast<int>(std::max(floor(mu1 - mu2 - 20.0*sd) - 20.0, -int_max));
+  hi = static_cast<int>(std::min(ceil(mu1 - mu2 + 20.0*sd) + 20.0, int_max));
+}
+
+inline double skellam_range_length(double mu1, double mu2) {
+  return 2.0*ceil(20.0*sqrt(mu1 + mu2)) + 41.0;
+}
+
+inline std::vector<double> cdf_skellam_table(double mu1, double mu2) {
+  int lo, hi;
+  skellam_range(mu1, mu2, lo, hi);
+  std::vector<double> p_tab = logpmf_skellam_table(lo, hi, mu1, mu2);
+  p_tab[0] = exp(p_tab[0]);
+  for (size_t k = 1; k < p_tab.size(); k++)
+    p_tab[k] = p_tab[k-1] + exp(p_tab[k]);
+  return p_tab;
+}
+
+// P(X <= x) for a single value by the relation to the noncentral
+// chi-squared distribution (Johnson, 1959), used when parameters are
+// not recycled enough to pay off building the tables
+
+inline double cdf_skellam(double x, double mu1, double mu2) {
+  x = floor(x);
+  if (x < 0.0)
+    return R::pnchisq(2.0*mu2, -2.0*x, 2.0*mu1, true, false);
+  return R::pnchisq(2.0*mu1, 2.0*(x + 1.0), 2.0*mu2, false, false);
+}
+
+// Quantile for a single value, 0 < p < 1: starting at the normal
+// approximation, the bracket F(lo) < p <= F(hi) is found by doubling
+// the steps and narrowed by bisection
+
+inline double invcdf_skellam(double p, double mu1, double mu2) {
+  
+  double int_max = to_dbl(std::numeric_limits<int>::max());
+  double lo, hi, mid, step;
+  auto above = [=](double k) { return cdf_skellam(k, mu1, mu2) >= p; };
+  
+  lo = std::round(mu1 - mu2 + sqrt(mu1 + mu2) * InvPhi(p));
+  hi = lo;
+  for (step = 1.0; above(lo); step *= 2.0) {
+    if (lo < -int_max)
+      return R_NegInf;
+    hi = lo;
+    lo -= step;
+  }
+  for (step = 1.0; !above(hi); step *= 2.0) {
+    if (hi > int_max)
+      return R_PosInf;
+    lo = hi;
+    hi += step;
+  }
+  
+  while (hi - lo > 1.0) {
+    mid = floor((lo + hi)/2.0);
+    if (above(mid))
+      hi = mid;
+    else
+      lo = mid;
+  }
+  return hi;
+}
+
+// Maximal value of the valid parameters, used to bound the size of tables
+
+inline double skellam_max_par(const NumericVector& mu) {
+  double mx = 0.0;
+  for (int i = 0; i < mu.length(); i++) {
+    if (!ISNAN(mu[i]) && mu[i] > mx)
+      mx = mu[i];
+  }
+  return mx;
 }
 
 inline double rng_skellam(double mu1, double mu2,
@@ -45,26 +206,172 @@ inline double rng_skellam(double mu1, double mu2,
 
 
 
+template <typename T>
+inline NumericVector dskellam_values(
+    const T& x,
+    const NumericVector& mu1,
+    const NumericVector& mu2,
+    const bool& log_prob
+  ) {
+  
+  int Nmax = std::max({
+    x.length(),
+    mu1.length(),
+    mu2.length()
+  });
+  int Npar = std::max({
+    mu1.length(),
+    mu2.length()
+  });
+  NumericVector p(Nmax);
+  const bool int_values = std::is_same<T, Rcpp::IntegerVector>::value;
+  
+  bool throw_warning = false;
+  
+  // when parameters are recycled, probabilities for the whole range
+  // of x values are computed at once by the recurrence, but only if
+  // the tables (one per distinct parameters) are not longer in total
+  // than the number of computed probabilities
+  
+  double lo = R_PosInf, hi = R_NegInf, xi;
+  for (int i = 0; i < x.length(); i++) {
+    xi = as_dbl(x[i]);
+    if (R_FINITE(xi) && (int_values || isInteger(xi, false))) {
+      lo = std::min(lo, xi);
+      hi = std::max(hi, xi);
+    }
+  }
+  
+  double extra = skellam_extra(skellam_max_par(mu1), skellam_max_par(mu2));
+  bool use_table = lo <= hi &&
+    (hi - lo + 1.0 + extra) * to_dbl(Npar) <= to_dbl(Nmax) &&
+    lo > to_dbl(std::numeric_limits<int>::min()) && !is_large_int(hi);
+  
+  std::map<std::tuple<int, int>, std::vector<double>> memo;
+  double m1, m2;
+  
+  for (int i = 0; i < Nmax; i++) {
+    
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+    
+    xi = as_dbl(GETV(x, i));
+    m1 = GETV(mu1, i);
+    m2 = GETV(mu2, i);
+    
+    if (use_table && R_FINITE(xi) && (int_values || isInteger(xi, false)) &&
+        !ISNAN(m1) && !ISNAN(m2) && m1 >= 0.0 && m2 >= 0.0) {
+      
+      std::vector<double>& tmp = memo[std::make_tuple(i % mu1.length(),
+                                                      i % mu2.length())];
+      if (!tmp.size()) {
+        tmp = logpmf_skellam_table(static_cast<int>(lo), static_cast<int>(hi),
+                                   m1, m2);
+      }
+      p[i] = tmp[static_cast<int>(xi - lo)];
+      
+    } else {
+      p[i] = logpmf_skellam(xi, m1, m2, throw_warning, int_values);
+    }
+  }
+  
+  if (!log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_dskellam(
-    const NumericVector& x,
+    SEXP x,
     const NumericVector& mu1,
     const NumericVector& mu2,
     const bool& log_prob = false
   ) {
   
+  if (TYPEOF(x) == INTSXP)
+    return dskellam_values(Rcpp::IntegerVector(x), mu1, mu2, log_prob);
+  return dskellam_values(NumericVector(x), mu1, mu2, log_prob);
+}
+
+
+template <typename T>
+inline NumericVector pskellam_values(
+    const T& x,
+    const NumericVector& mu1,
+    const NumericVector& mu2,
+    const bool& lower_tail,
+    const bool& log_prob
+  ) {
+  
   int Nmax = std::max({
     x.length(),
     mu1.length(),
     mu2.length()
   });
+  int Npar = std::max({
+    mu1.length(),
+    mu2.length()
+  });
   NumericVector p(Nmax);
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
-    p[i] = pmf_skellam(GETV(x, i), GETV(mu1, i),
-                       GETV(mu2, i), throw_warning);
+  // tables are used only if they are not longer in total than the
+  // number of computed probabilities, otherwise the probabilities
+  // are computed separately
+  
+  bool use_table = to_dbl(Npar) * skellam_range_length(
+    skellam_max_par(mu1), skellam_max_par(mu2)) <= to_dbl(Nmax);
+  
+  std::map<std::tuple<int, int>, std::vector<double>> memo;
+  double xi, m1, m2;
+  int lo, hi;
+  
+  for (int i = 0; i < Nmax; i++) {
+    
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+    
+    xi = as_dbl(GETV(x, i));
+    m1 = GETV(mu1, i);
+    m2 = GETV(mu2, i);
+    
+    if (ISNAN(xi) || ISNAN(m1) || ISNAN(m2)) {
+      p[i] = xi + m1 + m2;
+      continue;
+    } else if (m1 < 0.0 || m2 < 0.0) {
+      throw_warning = true;
+      p[i] = NAN;
+      continue;
+    }
+    
+    skellam_range(m1, m2, lo, hi);
+    
+    if (xi < to_dbl(lo)) {
+      p[i] = 0.0;
+    } else if (xi >= to_dbl(hi)) {
+      p[i] = 1.0;
+    } else if (!use_table) {
+      p[i] = cdf_skellam(xi, m1, m2);
+    } else {
+      
+      std::vector<double>& tmp = memo[std::make_tuple(i % mu1.length(),
+                                                      i % mu2.length())];
+      if (!tmp.size()) {
+        tmp = cdf_skellam_table(m1, m2);
+      }
+      p[i] = std::min(1.0, tmp[static_cast<int>(floor(xi) - to_dbl(lo))]);
+      
+    }
+  }
+  
+  if (!lower_tail)
+    p = 1.0 - p;
   
   if (log_prob)
     p = Rcpp::log(p);
@@ -77,23 +384,115 @@ NumericVector cpp_dskellam(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_rskellam(
+NumericVector cpp_pskellam(
+    SEXP x,
+    const NumericVector& mu1,
+    const NumericVector& mu2,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (TYPEOF(x) == INTSXP)
+    return pskellam_values(Rcpp::IntegerVector(x), mu1, mu2, lower_tail,
+                           log_prob);
+  return pskellam_values(NumericVector(x), mu1, mu2, lower_tail, log_prob);
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_qskellam(
+    const NumericVector& p,
+    const NumericVector& mu1,
+    const NumericVector& mu2,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  int Nmax = std::max({
+    p.length(),
+    mu1.length(),
+    mu2.length()
+  });
+  int Npar = std::max({
+    mu1.length(),
+    mu2.length()
+  });
+  NumericVector x(Nmax);
+  NumericVector pp = Rcpp::clone(p);
+  
+  bool throw_warning = false;
+  
+  bool use_table = to_dbl(Npar) * skellam_range_length(
+    skellam_max_par(mu1), skellam_max_par(mu2)) <= to_dbl(Nmax);
+  
+  std::map<std::tuple<int, int>, std::vector<double>> memo;
+  double m1, m2;
+  int lo, hi, j;
+  
+  if (log_prob)
+    pp = Rcpp::exp(pp);
+  
+  if (!lower_tail)
+    pp = 1.0 - pp;
+  
+  for (int i = 0; i < Nmax; i++) {
+    
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+    
+    m1 = GETV(mu1, i);
+    m2 = GETV(mu2, i);
+    
+    if (ISNAN(GETV(pp, i)) || ISNAN(m1) || ISNAN(m2)) {
+      x[i] = GETV(pp, i) + m1 + m2;
+    } else if (m1 < 0.0 || m2 < 0.0 || !VALID_PROB(GETV(pp, i))) {
+      throw_warning = true;
+      x[i] = NAN;
+    } else if (GETV(pp, i) == 0.0) {
+      x[i] = (m2 > 0.0) ? R_NegInf : 0.0;
+    } else if (GETV(pp, i) == 1.0) {
+      x[i] = (m1 > 0.0) ? R_PosInf : 0.0;
+    } else if (!use_table) {
+      x[i] = invcdf_skellam(GETV(pp, i), m1, m2);
+    } else {
+      
+      std::vector<double>& tmp = memo[std::make_tuple(i % mu1.length(),
+                                                      i % mu2.length())];
+      if (!tmp.size()) {
+        tmp = cdf_skellam_table(m1, m2);
+      }
+      skellam_range(m1, m2, lo, hi);
+      j = std::lower_bound(tmp.begin(), tmp.end(), GETV(pp, i)) - tmp.begin();
+      x[i] = to_dbl(lo) + to_dbl(std::min(j, static_cast<int>(tmp.size()) - 1));
+      
+    }
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return x;
+}
+
+
+// [[Rcpp::export]]
+SEXP cpp_rskellam(
     const int& n,
     const NumericVector& mu1,
     const NumericVector& mu2
   ) {
   
-  NumericVector x(n);
+  int_values x(n);
   
   bool throw_warning = false;
   
   for (int i = 0; i < n; i++)
-    x[i] = rng_skellam(GETV(mu1, i), GETV(mu2, i),
-                       throw_warning);
+    x.set(i, rng_skellam(GETV(mu1, i), GETV(mu2, i),
+                         throw_warning));
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
   
-  return x;
+  return x.result();
 }
 
@@ -51,6 +51,28 @@ inline double cdf_slash(double x, double mu, double sigma,
   return Phi(z) - (PHI_0 - phi(z))/z;
 }
 
+inline double invcdf_slash(double p, double mu, double sigma,
+                           double start, bool& throw_warning) {
+  if (ISNAN(p) || ISNAN(mu) || ISNAN(sigma))
+    return p+mu+sigma;
+  if (sigma <= 0.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (p == 0.0)
+    return R_NegInf;
+  if (p == 1.0)
+    return R_PosInf;
+  if (p == 0.5)
+    return mu;
+  if (ISNAN(start))
+    start = mu + sigma * InvPhi(p);
+  return invcdf_numeric(p,
+    [&](double x) { return cdf_slash(x, mu, sigma, throw_warning); },
+    [&](double x) { return pdf_slash(x, mu, sigma, throw_warning); },
+    R_NegInf, R_PosInf, start, throw_warning);
+}
+
 inline double rng_slash(double mu, double sigma,
                         bool& throw_warning) {
   if (ISNAN(mu) || ISNAN(sigma) || sigma <= 0.0) {
@@ -130,6 +152,51 @@ NumericVector cpp_pslash(
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_qslash(
+    const NumericVector& p,
+    const NumericVector& mu,
+    const NumericVector& sigma,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  int Nmax = std::max({
+    p.length(),
+    mu.length(),
+    sigma.length()
+  });
+  NumericVector x(Nmax);
+  NumericVector pp = Rcpp::clone(p);
+  
+  bool throw_warning = false;
+  double start;
+  
+  if (log_prob)
+    pp = Rcpp::exp(pp);
+  
+  if (!lower_tail)
+    pp = 1.0 - pp;
+  
+  for (int i = 0; i < Nmax; i++) {
+    // warm start at the previous quantile if parameters are unchanged
+    if (i > 0 && GETV(mu, i) == GETV(mu, i-1) &&
+        GETV(sigma, i) == GETV(sigma, i-1))
+      start = x[i-1];
+    else
+      start = NAN;
+    x[i] = invcdf_slash(GETV(pp, i), GETV(mu, i),
+                        GETV(sigma, i), start,
+                        throw_warning);
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return x;
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_rslash(
     const int& n,
@@ -0,0 +1,158 @@
+#include <Rcpp.h>
+#include "shared.h"
+#include "shared_families.h"
+// [[Rcpp::plugins(cpp11)]]
+
+#include <cstdio>
+#include <type_traits>
+
+using Rcpp::NumericVector;
+
+
+/*
+ *  Random generation from a given family written to a binary file
+ *
+ *  Parameters:
+ *  list of vectors of parameters of the family
+ *
+ *  The values are generated in blocks into a buffer that is reused, and
+ *  each block is written as raw doubles (or 32-bit integers for discrete
+ *  families) in the native byte order, so the memory used does not depend
+ *  on the number of values, and the file can be read with readBin or
+ *  memory-mapped.
+ *
+ */
+
+
+inline void stream_value(double x, double& out, bool& throw_warning) {
+  out = x;
+}
+
+// values outside of the integer range are written as NA
+
+inline void stream_value(double x, int& out, bool& throw_warning) {
+  if (ISNAN(x)) {
+    out = NA_INTEGER;
+  } else if (is_large_int(std::abs(x))) {
+    throw_warning = true;
+    out = NA_INTEGER;
+  } else {
+    out = static_cast<int>(x);
+  }
+}
+
+
+struct stream_file {
+  std::FILE* f;
+  stream_file(const std::string& path, bool append)
+    : f(std::fopen(path.c_str(), append ? "ab" : "wb")) {
+    if (!f)
+      Rcpp::stop("cannot open file '" + path + "'");
+  }
+  ~stream_file() {
+    if (f)
+      std::fclose(f);
+  }
+  template <typename T>
+  void write(const std::vector<T>& buf, size_t len) {
+    if (std::fwrite(buf.data(), sizeof(T), len, f) != len)
+      Rcpp::stop("error writing to file");
+  }
+  void close() {
+    int status = std::fclose(f);
+    f = NULL;
+    if (status != 0)
+      Rcpp::stop("error writing to file");
+  }
+};
+
+
+// T is the type of the written values, double or int
+
+template <typename T>
+struct stream_rng_op {
+  stream_file& out;
+  double n;
+  int block;
+  const std::vector<NumericVector>& params;
+  template <typename F> double run() const {
+  
+    if (static_cast<int>(params.size()) != F::npar)
+      Rcpp::stop("wrong number of parameters");
+    if (std::is_same<T, int>::value && !F::discrete)
+      Rcpp::stop("family of distributions should be discrete");
+  
+    for (int m = 0; m < F::npar; m++) {
+      if (params[m].length() < 1)
+        return 0.0;
+    }
+  
+    std::vector<T> buf(block);
+    double par[F::npar];
+    double nans_sum, xi;
+    bool throw_warning = false;
+    R_xlen_t len, total = static_cast<R_xlen_t>(n);
+  
+    for (R_xlen_t start = 0; start < total; start += len) {
+  
+      Rcpp::checkUserInterrupt();
+      len = std::min(static_cast<R_xlen_t>(block), total - start);
+  
+      for (R_xlen_t i = start; i < start + len; i++) {
+  
+        nans_sum = 0.0;
+        for (int m = 0; m < F::npar; m++) {
+          par[m] = params[m][i % params[m].length()];
+          nans_sum += par[m];
+        }
+  
+        if (ISNAN(nans_sum) || !F::valid(par)) {
+          throw_warning = true;
+          xi = NA_REAL;
+        } else {
+          xi = F::rng(par, throw_warning);
+        }
+  
+        stream_value(xi, buf[i - start], throw_warning);
+      }
+  
+      out.write(buf, len);
+    }
+  
+    if (throw_warning)
+      Rcpp::warning("NAs produced");
+  
+    return static_cast<double>(total);
+  }
+};
+
+
+// [[Rcpp::export]]
+double cpp_rstream(
+    const std::string& file,
+    const double& n,
+    const std::string& family,
+    const Rcpp::List& params,
+    const bool& as_integer = false,
+    const int& block = 65536,
+    const bool& append = false
+  ) {
+  
+  if (!R_FINITE(n) || n < 0.0 || n > R_XLEN_T_MAX || !isInteger(n, false))
+    Rcpp::stop("n should be a non-negative integer of at most R_XLEN_T_MAX");
+  if (block < 1)
+    Rcpp::stop("invalid arguments");
+  
+  std::vector<NumericVector> par_list = param_list(params);
+  
+  stream_file out(file, append);
+  double written;
+  
+  if (as_integer)
+    written = dispatch_family(family, stream_rng_op<int>{ out, n, block, par_list });
+  else
+    written = dispatch_family(family, stream_rng_op<double>{ out, n, block, par_list });
+  
+  out.close();
+  return written;
+}
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_bounded.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -13,7 +14,8 @@ using Rcpp::NumericVector;
 
 
 inline double pdf_tbinom(double x, double size, double prob, double a,
-                         double b, bool& throw_warning) {
+                         double b, bool& throw_warning,
+                         bool int_x = false) {
   if (ISNAN(x) || ISNAN(size) || ISNAN(prob) || ISNAN(a) || ISNAN(b))
     return x+size+prob+a+b;
   if (size < 0.0 || !VALID_PROB(prob) || b < a || !isInteger(size, false)) {
@@ -21,7 +23,7 @@ inline double pdf_tbinom(double x, double size, double prob, double a,
     return NAN;
   }
   
-  if (!isInteger(x) || x < 0.0 || x <= a || x > b || x > size)
+  if ((!int_x && !isInteger(x)) || x < 0.0 || x <= a || x > b || x > size)
     return 0.0;
   
   double pa, pb;
@@ -93,14 +95,36 @@ inline double rng_tbinom(double size, double prob, double a,
 }
 
 
-// [[Rcpp::export]]
-NumericVector cpp_dtbinom(
-    const NumericVector& x,
+// binomial distribution for bounded_rng
+
+struct tbinom_dist {
+  double size, prob;
+  double mode() const {
+    return floor((size + 1.0) * prob);
+  }
+  double ratio(double x) const {
+    return (size - x) / (x + 1.0) * prob / (1.0 - prob);
+  }
+  double cdf(double x) const {
+    return R::pbinom(x, size, prob, true, false);
+  }
+  double invcdf(double p) const {
+    return R::qbinom(p, size, prob, true, false);
+  }
+  double rng() const {
+    return R::rbinom(size, prob);
+  }
+};
+
+
+template <typename T>
+inline NumericVector dtbinom_values(
+    const T& x,
     const NumericVector& size,
     const NumericVector& prob,
     const NumericVector& lower,
     const NumericVector& upper,
-    const bool& log_prob = false
+    const bool& log_prob
   ) {
   
   int Nmax = std::max({
@@ -111,13 +135,14 @@ NumericVector cpp_dtbinom(
     upper.length()
   });
   NumericVector p(Nmax);
+  const bool int_values = std::is_same<T, Rcpp::IntegerVector>::value;
   
   bool throw_warning = false;
   
   for (int i = 0; i < Nmax; i++)
-    p[i] = pdf_tbinom(GETV(x, i), GETV(size, i),
+    p[i] = pdf_tbinom(as_dbl(GETV(x, i)), GETV(size, i),
                       GETV(prob, i), GETV(lower, i),
-                      GETV(upper, i), throw_warning);
+                      GETV(upper, i), throw_warning, int_values);
   
   if (log_prob)
     p = Rcpp::log(p);
@@ -130,16 +155,33 @@ NumericVector cpp_dtbinom(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_ptbinom(
-    const NumericVector& x,
+NumericVector cpp_dtbinom(
+    SEXP x,
     const NumericVector& size,
     const NumericVector& prob,
     const NumericVector& lower,
     const NumericVector& upper,
-    const bool& lower_tail = true,
     const bool& log_prob = false
   ) {
   
+  if (TYPEOF(x) == INTSXP)
+    return dtbinom_values(Rcpp::IntegerVector(x), size, prob, lower, upper,
+                          log_prob);
+  return dtbinom_values(NumericVector(x), size, prob, lower, upper, log_prob);
+}
+
+
+template <typename T>
+inline NumericVector ptbinom_values(
+    const T& x,
+    const NumericVector& size,
+    const NumericVector& prob,
+    const NumericVector& lower,
+    const NumericVector& upper,
+    const bool& lower_tail,
+    const bool& log_prob
+  ) {
+  
   int Nmax = std::max({
     x.length(),
     size.length(),
@@ -152,7 +194,7 @@ NumericVector cpp_ptbinom(
   bool throw_warning = false;
   
   for (int i = 0; i < Nmax; i++)
-    p[i] = cdf_tbinom(GETV(x, i), GETV(size, i),
+    p[i] = cdf_tbinom(as_dbl(GETV(x, i)), GETV(size, i),
                       GETV(prob, i), GETV(lower, i),
                       GETV(upper, i), throw_warning);
   
@@ -169,6 +211,25 @@ NumericVector cpp_ptbinom(
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_ptbinom(
+    SEXP x,
+    const NumericVector& size,
+    const NumericVector& prob,
+    const NumericVector& lower,
+    const NumericVector& upper,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (TYPEOF(x) == INTSXP)
+    return ptbinom_values(Rcpp::IntegerVector(x), size, prob, lower, upper,
+                          lower_tail, log_prob);
+  return ptbinom_values(NumericVector(x), size, prob, lower, upper,
+                        lower_tail, log_prob);
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_qtbinom(
     const NumericVector& p,
@@ -211,7 +272,7 @@ NumericVector cpp_qtbinom(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_rtbinom(
+SEXP cpp_rtbinom(
     const int& n,
     const NumericVector& size,
     const NumericVector& prob,
@@ -219,18 +280,70 @@ NumericVector cpp_rtbinom(
     const NumericVector& upper
   ) {
   
-  NumericVector x(n);
+  int_values x(n);
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
-    x[i] = rng_tbinom(GETV(size, i), GETV(prob, i),
-                      GETV(lower, i), GETV(upper, i),
-                      throw_warning);
+  int Npar = std::max({
+    size.length(),
+    prob.length(),
+    lower.length(),
+    upper.length()
+  });
+  bool reuse = n > Npar;
+  
+  // samplers are set up once per unique combination of parameters
+  
+  std::map<std::tuple<int, int, int, int>, bounded_rng<tbinom_dist>> memo;
+  double m, p, a, b, lo, hi;
+  
+  for (int i = 0; i < n; i++) {
+    
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+    
+    m = GETV(size, i);
+    p = GETV(prob, i);
+    a = GETV(lower, i);
+    b = GETV(upper, i);
+    
+    if (ISNAN(m) || ISNAN(p) || ISNAN(a) || ISNAN(b) ||
+        m < 0.0 || !VALID_PROB(p) || b < a || !isInteger(m, false)) {
+      throw_warning = true;
+      x.set(i, NA_REAL);
+      continue;
+    }
+    
+    lo = std::max(floor(a) + 1.0, 0.0);
+    hi = std::min(floor(b), m);
+    
+    // degenerate cases are handled by the inversion kernel
+    if (p == 0.0 || p == 1.0 || lo > hi || !R_FINITE(lo)) {
+      x.set(i, rng_tbinom(m, p, a, b, throw_warning));
+      continue;
+    }
+    
+    tbinom_dist dist = { m, p };
+    
+    if (!reuse) {
+      x.set(i, bounded_rng<tbinom_dist>(dist, lo, hi, sqrt(m*p*(1.0-p)), false).draw());
+      continue;
+    }
+    
+    auto key = std::make_tuple(i % size.length(),
+                               i % prob.length(),
+                               i % lower.length(),
+                               i % upper.length());
+    auto it = memo.find(key);
+    if (it == memo.end())
+      it = memo.insert(std::make_pair(key, bounded_rng<tbinom_dist>(
+        dist, lo, hi, sqrt(m*p*(1.0-p)), true))).first;
+    x.set(i, it->second.draw());
+  }
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
   
-  return x;
+  return x.result();
 }
 
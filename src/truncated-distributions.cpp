@@ -0,0 +1,137 @@
+#include <Rcpp.h>
+#include "shared.h"
+#include "shared_families.h"
+#include "shared_truncation.h"
+// [[Rcpp::plugins(cpp11)]]
+
+using std::pow;
+using std::sqrt;
+using std::abs;
+using std::exp;
+using std::log;
+using std::floor;
+using std::ceil;
+using Rcpp::NumericVector;
+
+
+/*
+ *  Distributions from a given family truncated to (a, b]
+ *
+ *  Parameters:
+ *  list of vectors of parameters of the family
+ *  a, b (truncation points, a < b)
+ *
+ *  f(x) = g(x) / (G(b) - G(a))
+ *  F(x) = (G(x) - G(a)) / (G(b) - G(a))
+ *
+ */
+
+
+struct trunc_pdf_op {
+  const NumericVector& x;
+  const std::vector<NumericVector>& params;
+  const NumericVector& lower;
+  const NumericVector& upper;
+  bool log_prob;
+  template <typename F> NumericVector run() const {
+    return truncated_pdf<F>(x, params, lower, upper, log_prob);
+  }
+};
+
+struct trunc_cdf_op {
+  const NumericVector& x;
+  const std::vector<NumericVector>& params;
+  const NumericVector& lower;
+  const NumericVector& upper;
+  bool lower_tail, log_prob;
+  template <typename F> NumericVector run() const {
+    return truncated_cdf<F>(x, params, lower, upper, lower_tail, log_prob);
+  }
+};
+
+struct trunc_invcdf_op {
+  const NumericVector& p;
+  const std::vector<NumericVector>& params;
+  const NumericVector& lower;
+  const NumericVector& upper;
+  bool lower_tail, log_prob;
+  template <typename F> NumericVector run() const {
+    return truncated_invcdf<F>(p, params, lower, upper, lower_tail, log_prob);
+  }
+};
+
+struct trunc_rng_op {
+  int n;
+  const std::vector<NumericVector>& params;
+  const NumericVector& lower;
+  const NumericVector& upper;
+  template <typename F> NumericVector run() const {
+    return truncated_rng<F>(n, params, lower, upper);
+  }
+};
+
+
+// [[Rcpp::export]]
+NumericVector cpp_dtrunc(
+    const NumericVector& x,
+    const std::string& family,
+    const Rcpp::List& params,
+    const NumericVector& lower,
+    const NumericVector& upper,
+    const bool& log_prob = false
+  ) {
+  
+  std::vector<NumericVector> par = param_list(params);
+  trunc_pdf_op op = { x, par, lower, upper, log_prob };
+  return dispatch_family(family, op);
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_ptrunc(
+    const NumericVector& x,
+    const std::string& family,
+    const Rcpp::List& params,
+    const NumericVector& lower,
+    const NumericVector& upper,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  std::vector<NumericVector> par = param_list(params);
+  trunc_cdf_op op = { x, par, lower, upper, lower_tail, log_prob };
+  return dispatch_family(family, op);
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_qtrunc(
+    const NumericVector& p,
+    const std::string& family,
+    const Rcpp::List& params,
+    const NumericVector& lower,
+    const NumericVector& upper,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  std::vector<NumericVector> par = param_list(params);
+  trunc_invcdf_op op = { p, par, lower, upper, lower_tail, log_prob };
+  return dispatch_family(family, op);
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_rtrunc(
+    const int& n,
+    const std::string& family,
+    const Rcpp::List& params,
+    const NumericVector& lower,
+    const NumericVector& upper
+  ) {
+  
+  std::vector<NumericVector> par = param_list(params);
+  trunc_rng_op op = { n, par, lower, upper };
+  return dispatch_family(family, op);
+}
+
@@ -1,5 +1,7 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_families.h"
+#include "shared_kernels.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -109,22 +111,31 @@ double rng_tnorm(double mu, double sigma, double a,
   }
   
   // non-truncated normal
-  if (a == R_NegInf && b == R_PosInf)
+  if (a == R_NegInf && b == R_PosInf) {
+    if (sampler_diag.enabled())
+      sampler_diag.record("tnorm: normal", 1.0);
     return R::rnorm(mu, sigma);
-
+  }
+  
   double r, u, za, zb, aa, za_sq, zb_sq;
   bool stop = false;
-
+  
+  // branch of the algorithm and number of proposals, for diagnostics
+  const char* regime;
+  double iter = 1.0;
+  
   za = (a-mu)/sigma;
   zb = (b-mu)/sigma;
   za_sq = pow(za, 2.0);
   zb_sq = pow(zb, 2.0);
   
   if (abs(za) <= 1e-16 && zb == R_PosInf) {
+    regime = "tnorm: half-normal";
     r = R::norm_rand();
     if (r < 0.0)
       r = -r;
   } else if (za == R_PosInf && abs(zb) <= 1e-16) {
+    regime = "tnorm: half-normal";
     r = R::norm_rand();
     if (r > 0.0)
       r = -r;
@@ -132,15 +143,17 @@ double rng_tnorm(double mu, double sigma, double a,
       (za == R_NegInf && zb > 0.0) ||
       (za != R_PosInf && zb != R_PosInf &&
        za < 0.0 && zb > 0.0 && zb-za > SQRT_2_PI)) {
-    while (!stop) {
+    regime = "tnorm: normal rejection";
+    for (iter = 0.0; !stop; iter++) {
       r = R::norm_rand();
       if (r >= za && r <= zb)
         stop = true;
     }
   } else if (za >= 0.0 && (zb > za + 2.0*sqrt(M_E) / (za + sqrt(za_sq + 4.0))
                       * exp((za*2.0 - za*sqrt(za_sq + 4.0)) / 4.0))) {
+    regime = "tnorm: exponential rejection (upper tail)";
     aa = (za + sqrt(za_sq + 4.0)) / 2.0;
-    while (!stop) {
+    for (iter = 0.0; !stop; iter++) {
       r = R::exp_rand() / aa + za;
       u = rng_unif();
       if ((u <= exp(-pow(r-aa, 2.0) / 2.0)) && (r <= zb))
@@ -148,8 +161,9 @@ double rng_tnorm(double mu, double sigma, double a,
     }
   } else if (zb <= 0.0 && (-za > -zb + 2.0*sqrt(M_E) / (-zb + sqrt(zb_sq + 4.0))
                           * exp((zb*2.0 + zb*sqrt(zb_sq + 4.0)) / 4.0))) {
+    regime = "tnorm: exponential rejection (lower tail)";
     aa = (-zb + sqrt(zb_sq + 4.0)) / 2.0;
-    while (!stop) {
+    for (iter = 0.0; !stop; iter++) {
       r = R::exp_rand() / aa - zb;
       u = rng_unif();
       if ((u <= exp(-pow(r-aa, 2.0) / 2.0)) && (r >= za)) {
@@ -158,30 +172,157 @@ double rng_tnorm(double mu, double sigma, double a,
       }
     }
   } else {
+    regime = "tnorm: uniform rejection";
     if (0.0 < za) {
-      while (!stop) {
+      for (iter = 0.0; !stop; iter++) {
         r = R::runif(za, zb);
         u = rng_unif();
         stop = (u <= exp((za_sq - pow(r, 2.0))/2.0));
       }
     } else if (zb < 0.0) {
-      while (!stop) {
+      for (iter = 0.0; !stop; iter++) {
         r = R::runif(za, zb);
         u = rng_unif();
         stop = (u <= exp((zb_sq - pow(r, 2.0))/2.0));
       }
     } else {
-      while (!stop) {
+      for (iter = 0.0; !stop; iter++) {
         r = R::runif(za, zb);
         u = rng_unif();
         stop = (u <= exp(-pow(r, 2.0)/2.0));
       }
     }
   }
+  
+  if (sampler_diag.enabled())
+    sampler_diag.record(regime, iter);
 
   return mu + sigma * r;
 }
 
+// log-density and its derivatives with respect to mu and sigma
+// (the truncation points are fixed), written to grad; outside of
+// the support the derivatives are zero
+
+double score_tnorm(double x, double mu, double sigma, double a,
+                   double b, double* grad, bool& throw_warning) {
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(a) || ISNAN(b)) {
+    grad[0] = grad[1] = x+mu+sigma+a+b;
+    return x+mu+sigma+a+b;
+  }
+  if (sigma <= 0.0 || b <= a) {
+    throw_warning = true;
+    grad[0] = grad[1] = NAN;
+    return NAN;
+  }
+  if (x <= a || x >= b || !R_FINITE(x)) {
+    grad[0] = grad[1] = 0.0;
+    return R_NegInf;
+  }
+  
+  double z = (x-mu)/sigma;
+  double za = (a-mu)/sigma;
+  double zb = (b-mu)/sigma;
+  
+  // normalizing constant Phi(zb) - Phi(za), computed in the upper
+  // tail when the interval is above the mean, and the terms
+  // phi(za) - phi(zb), za*phi(za) - zb*phi(zb) of its derivatives
+  
+  double Z = (za > 0.0) ? Phi(-za) - Phi(-zb) : Phi(zb) - Phi(za);
+  double dmu = 0.0, dsigma = 0.0;
+  if (R_FINITE(za)) {
+    dmu += phi(za);
+    dsigma += za*phi(za);
+  }
+  if (R_FINITE(zb)) {
+    dmu -= phi(zb);
+    dsigma -= zb*phi(zb);
+  }
+  
+  grad[0] = (z - dmu/Z) / sigma;
+  grad[1] = (z*z - 1.0 - dsigma/Z) / sigma;
+  return -z*z/2.0 - log(SQRT_2_PI*sigma) - log(Z);
+}
+
+// log-probability of the (lo, hi) interval for the standard normal
+// distribution, computed in the upper tail when it is above the mean
+
+inline double tnorm_lmass(double lo, double hi) {
+  if (lo > 0.0)
+    return log_sub_exp(R::pnorm(-lo, 0.0, 1.0, true, true),
+                       R::pnorm(-hi, 0.0, 1.0, true, true));
+  return log_sub_exp(R::pnorm(hi, 0.0, 1.0, true, true),
+                     R::pnorm(lo, 0.0, 1.0, true, true));
+}
+
+// log f(x) (status = 1), log(1-F(x)) (status = 0) or log F(x)
+// (status = 2), sharing the standardization and the truncation mass
+
+double logcens_tnorm(double x, double status, double mu, double sigma,
+                     double a, double b, bool& throw_warning) {
+  if (ISNAN(x) || ISNAN(status) || ISNAN(mu) || ISNAN(sigma) || ISNAN(a) || ISNAN(b))
+    return x+status+mu+sigma+a+b;
+  if (sigma <= 0.0 || b <= a || (status != 0.0 && status != 1.0 && status != 2.0)) {
+    throw_warning = true;
+    return NAN;
+  }
+  
+  double z = (x-mu)/sigma;
+  double za = (a-mu)/sigma;
+  double zb = (b-mu)/sigma;
+  double lZ = tnorm_lmass(za, zb);
+  
+  if (status == 1.0) {
+    if (x <= a || x >= b || !R_FINITE(x))
+      return R_NegInf;
+    return -z*z/2.0 - log(SQRT_2_PI*sigma) - lZ;
+  } else if (status == 0.0) {
+    if (x <= a)
+      return 0.0;
+    if (x >= b)
+      return R_NegInf;
+    return tnorm_lmass(z, zb) - lZ;
+  } else {
+    if (x >= b)
+      return 0.0;
+    if (x <= a)
+      return R_NegInf;
+    return tnorm_lmass(za, z) - lZ;
+  }
+}
+
+// log P(lo < X <= hi), sharing the truncation mass between the
+// endpoints; narrow intervals are integrated numerically
+
+double logint_tnorm(double lo, double hi, double mu, double sigma,
+                    double a, double b, bool& throw_warning) {
+  if (ISNAN(lo) || ISNAN(hi) || ISNAN(mu) || ISNAN(sigma) || ISNAN(a) || ISNAN(b))
+    return lo+hi+mu+sigma+a+b;
+  if (sigma <= 0.0 || b <= a || lo > hi) {
+    throw_warning = true;
+    return NAN;
+  }
+  
+  lo = std::max(lo, a);
+  hi = std::min(hi, b);
+  if (hi <= lo)
+    return R_NegInf;
+  
+  double zl = (lo-mu)/sigma;
+  double zh = (hi-mu)/sigma;
+  double lZ = tnorm_lmass((a-mu)/sigma, (b-mu)/sigma);
+  
+  // integrated over x, since the width of the interval is
+  // exact in x but not after standardization
+  if ((zh - zl) * (std::max(abs(zl), abs(zh)) + 1.0) < 0.05) {
+    return log_integrate_narrow(lo, hi, [&](double x) {
+      double z = (x-mu)/sigma;
+      return -z*z/2.0 - log(SQRT_2_PI*sigma);
+    }) - lZ;
+  }
+  return tnorm_lmass(zl, zh) - lZ;
+}
+
 
 // [[Rcpp::export]]
 NumericVector cpp_dtnorm(
@@ -190,7 +331,8 @@ NumericVector cpp_dtnorm(
     const NumericVector& sigma,
     const NumericVector& lower,
     const NumericVector& upper,
-    const bool& log_prob = false
+    const bool& log_prob = false,
+    SEXP out = R_NilValue
   ) {
 
   int Nmax = std::max({
@@ -200,17 +342,17 @@ NumericVector cpp_dtnorm(
     lower.length(),
     upper.length()
   });
-  NumericVector p(Nmax);
+  NumericVector p = output_vector(out, Nmax);
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  for (int i = 0; i < Nmax; i++) {
     p[i] = pdf_tnorm(GETV(x, i), GETV(mu, i),
                      GETV(sigma, i), GETV(lower, i),
                      GETV(upper, i), throw_warning);
-
-  if (log_prob)
-    p = Rcpp::log(p);
+    if (log_prob)
+      p[i] = log(p[i]);
+  }
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -227,7 +369,8 @@ NumericVector cpp_ptnorm(
     const NumericVector& lower,
     const NumericVector& upper,
     const bool& lower_tail = true,
-    const bool& log_prob = false
+    const bool& log_prob = false,
+    SEXP out = R_NilValue
   ) {
 
   int Nmax = std::max({
@@ -237,20 +380,19 @@ NumericVector cpp_ptnorm(
     lower.length(),
     upper.length()
   });
-  NumericVector p(Nmax);
+  NumericVector p = output_vector(out, Nmax);
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  for (int i = 0; i < Nmax; i++) {
     p[i] = cdf_tnorm(GETV(x, i), GETV(mu, i),
                      GETV(sigma, i), GETV(lower, i),
                      GETV(upper, i), throw_warning);
-
-  if (!lower_tail)
-    p = 1.0 - p;
-  
-  if (log_prob)
-    p = Rcpp::log(p);
+    if (!lower_tail)
+      p[i] = 1.0 - p[i];
+    if (log_prob)
+      p[i] = log(p[i]);
+  }
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -267,7 +409,8 @@ NumericVector cpp_qtnorm(
     const NumericVector& lower,
     const NumericVector& upper,
     const bool& lower_tail = true,
-    const bool& log_prob = false
+    const bool& log_prob = false,
+    SEXP out = R_NilValue
   ) {
 
   int Nmax = std::max({
@@ -277,21 +420,21 @@ NumericVector cpp_qtnorm(
     lower.length(),
     upper.length()
   });
-  NumericVector x(Nmax);
-  NumericVector pp = Rcpp::clone(p);
+  NumericVector x = output_vector(out, Nmax);
+  double pi;
   
   bool throw_warning = false;
-  
-  if (log_prob)
-    pp = Rcpp::exp(pp);
-  
-  if (!lower_tail)
-    pp = 1.0 - pp;
 
-  for (int i = 0; i < Nmax; i++)
-    x[i] = invcdf_tnorm(GETV(pp, i), GETV(mu, i),
+  for (int i = 0; i < Nmax; i++) {
+    pi = GETV(p, i);
+    if (log_prob)
+      pi = exp(pi);
+    if (!lower_tail)
+      pi = 1.0 - pi;
+    x[i] = invcdf_tnorm(pi, GETV(mu, i),
                         GETV(sigma, i), GETV(lower, i),
                         GETV(upper, i), throw_warning);
+  }
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -306,10 +449,11 @@ NumericVector cpp_rtnorm(
     const NumericVector& mu,
     const NumericVector& sigma,
     const NumericVector& lower,
-    const NumericVector& upper
+    const NumericVector& upper,
+    SEXP out = R_NilValue
   ) {
 
-  NumericVector x(n);
+  NumericVector x = output_vector(out, n);
   
   bool throw_warning = false;
 
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_bounded.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -13,7 +14,8 @@ using Rcpp::NumericVector;
 
 
 inline double pdf_tpois(double x, double lambda, double a,
-                        double b, bool& throw_warning) {
+                        double b, bool& throw_warning,
+                        bool int_x = false) {
   if (ISNAN(x) || ISNAN(lambda) || ISNAN(a) || ISNAN(b))
     return x+lambda+a+b;
   if (lambda < 0.0 || b < a) {
@@ -21,7 +23,8 @@ inline double pdf_tpois(double x, double lambda, double a,
     return NAN;
   }
   
-  if (!isInteger(x) || x < 0.0 || x <= a || x > b || !R_FINITE(x))
+  if ((!int_x && !isInteger(x)) || x < 0.0 || x <= a || x > b ||
+      !R_FINITE(x))
     return 0.0;
   
   // if (a == 0.0 && b == R_PosInf)
@@ -96,13 +99,35 @@ inline double rng_tpois(double lambda, double a, double b,
 }
 
 
-// [[Rcpp::export]]
-NumericVector cpp_dtpois(
-    const NumericVector& x,
+// Poisson distribution for bounded_rng
+
+struct tpois_dist {
+  double lambda;
+  double mode() const {
+    return floor(lambda);
+  }
+  double ratio(double x) const {
+    return lambda / (x + 1.0);
+  }
+  double cdf(double x) const {
+    return R::ppois(x, lambda, true, false);
+  }
+  double invcdf(double p) const {
+    return R::qpois(p, lambda, true, false);
+  }
+  double rng() const {
+    return R::rpois(lambda);
+  }
+};
+
+
+template <typename T>
+inline NumericVector dtpois_values(
+    const T& x,
     const NumericVector& lambda,
     const NumericVector& lower,
     const NumericVector& upper,
-    const bool& log_prob = false
+    const bool& log_prob
   ) {
   
   int Nmax = std::max({
@@ -112,13 +137,14 @@ NumericVector cpp_dtpois(
     upper.length()
   });
   NumericVector p(Nmax);
+  const bool int_values = std::is_same<T, Rcpp::IntegerVector>::value;
   
   bool throw_warning = false;
   
   for (int i = 0; i < Nmax; i++)
-    p[i] = pdf_tpois(GETV(x, i), GETV(lambda, i),
+    p[i] = pdf_tpois(as_dbl(GETV(x, i)), GETV(lambda, i),
                      GETV(lower, i), GETV(upper, i),
-                     throw_warning);
+                     throw_warning, int_values);
   
   if (log_prob)
     p = Rcpp::log(p);
@@ -131,15 +157,31 @@ NumericVector cpp_dtpois(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_ptpois(
-    const NumericVector& x,
+NumericVector cpp_dtpois(
+    SEXP x,
     const NumericVector& lambda,
     const NumericVector& lower,
     const NumericVector& upper,
-    const bool& lower_tail = true,
     const bool& log_prob = false
   ) {
   
+  if (TYPEOF(x) == INTSXP)
+    return dtpois_values(Rcpp::IntegerVector(x), lambda, lower, upper,
+                         log_prob);
+  return dtpois_values(NumericVector(x), lambda, lower, upper, log_prob);
+}
+
+
+template <typename T>
+inline NumericVector ptpois_values(
+    const T& x,
+    const NumericVector& lambda,
+    const NumericVector& lower,
+    const NumericVector& upper,
+    const bool& lower_tail,
+    const bool& log_prob
+  ) {
+  
   int Nmax = std::max({
     x.length(),
     lambda.length(),
@@ -151,7 +193,7 @@ NumericVector cpp_ptpois(
   bool throw_warning = false;
   
   for (int i = 0; i < Nmax; i++)
-    p[i] = cdf_tpois(GETV(x, i), GETV(lambda, i),
+    p[i] = cdf_tpois(as_dbl(GETV(x, i)), GETV(lambda, i),
                      GETV(lower, i), GETV(upper, i),
                      throw_warning);
   
@@ -168,6 +210,24 @@ NumericVector cpp_ptpois(
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_ptpois(
+    SEXP x,
+    const NumericVector& lambda,
+    const NumericVector& lower,
+    const NumericVector& upper,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (TYPEOF(x) == INTSXP)
+    return ptpois_values(Rcpp::IntegerVector(x), lambda, lower, upper,
+                         lower_tail, log_prob);
+  return ptpois_values(NumericVector(x), lambda, lower, upper, lower_tail,
+                       log_prob);
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_qtpois(
     const NumericVector& p,
@@ -208,24 +268,73 @@ NumericVector cpp_qtpois(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_rtpois(
+SEXP cpp_rtpois(
     const int& n,
     const NumericVector& lambda,
     const NumericVector& lower,
     const NumericVector& upper
   ) {
   
-  NumericVector x(n);
+  int_values x(n);
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
-    x[i] = rng_tpois(GETV(lambda, i), GETV(lower, i),
-                     GETV(upper, i), throw_warning);
+  int Npar = std::max({
+    lambda.length(),
+    lower.length(),
+    upper.length()
+  });
+  bool reuse = n > Npar;
+  
+  // samplers are set up once per unique combination of parameters
+  
+  std::map<std::tuple<int, int, int>, bounded_rng<tpois_dist>> memo;
+  double l, a, b, lo, hi;
+  
+  for (int i = 0; i < n; i++) {
+    
+    if (i % 1000 == 0)
+      Rcpp::checkUserInterrupt();
+    
+    l = GETV(lambda, i);
+    a = GETV(lower, i);
+    b = GETV(upper, i);
+    
+    if (ISNAN(l) || ISNAN(a) || ISNAN(b) || l < 0.0 || b < a) {
+      throw_warning = true;
+      x.set(i, NA_REAL);
+      continue;
+    }
+    
+    lo = std::max(floor(a) + 1.0, 0.0);
+    hi = floor(b);
+    
+    // degenerate cases are handled by the inversion kernel
+    if (l == 0.0 || lo > hi || !R_FINITE(lo)) {
+      x.set(i, rng_tpois(l, a, b, throw_warning));
+      continue;
+    }
+    
+    tpois_dist dist = { l };
+    
+    if (!reuse) {
+      x.set(i, bounded_rng<tpois_dist>(dist, lo, hi, sqrt(l), false).draw());
+      continue;
+    }
+    
+    auto key = std::make_tuple(i % lambda.length(),
+                               i % lower.length(),
+                               i % upper.length());
+    auto it = memo.find(key);
+    if (it == memo.end())
+      it = memo.insert(std::make_pair(key, bounded_rng<tpois_dist>(
+        dist, lo, hi, sqrt(l), true))).first;
+    x.set(i, it->second.draw());
+  }
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
   
-  return x;
+  return x.result();
 }
 
@@ -19,6 +19,10 @@ Journal of the American Statistical Association, 66(334), 394-399.
 Hastings Jr, C., Mosteller, F., Tukey, J.W., & Winsor, C.P. (1947).
 Low moments for small samples: a comparative study of order statistics.
 The Annals of Mathematical Statistics, 413-426.
+
+Tukey lambda distribution has no closed-form cdf, it is computed
+by numerically inverting the quantile function Q, and the density
+follows from f(Q(p)) = 1/Q'(p).
 */
 
 
@@ -35,6 +39,40 @@ inline double invcdf_tlambda(double p, double lambda,
   return (pow(p, lambda) - pow(1.0 - p, lambda))/lambda;
 }
 
+// derivative of the quantile function
+inline double dinvcdf_tlambda(double p, double lambda) {
+  if (lambda == 0.0)
+    return 1.0/p + 1.0/(1.0 - p);
+  return pow(p, lambda - 1.0) + pow(1.0 - p, lambda - 1.0);
+}
+
+inline double cdf_tlambda(double x, double lambda, double start,
+                          bool& throw_warning) {
+  if (ISNAN(x) || ISNAN(lambda))
+    return x+lambda;
+  if (lambda == 0.0)
+    return 1.0/(1.0 + exp(-x));
+  if (x == R_NegInf || (lambda > 0.0 && x <= -1.0/lambda))
+    return 0.0;
+  if (x == R_PosInf || (lambda > 0.0 && x >= 1.0/lambda))
+    return 1.0;
+  if (ISNAN(start))
+    start = 0.5;
+  return invcdf_numeric(x,
+    [&](double p) { return invcdf_tlambda(p, lambda, throw_warning); },
+    [&](double p) { return dinvcdf_tlambda(p, lambda); },
+    0.0, 1.0, start, throw_warning);
+}
+
+// density at x given Fx = F(x)
+inline double pdf_tlambda(double x, double lambda, double Fx) {
+  if (ISNAN(x) || ISNAN(lambda) || ISNAN(Fx))
+    return x+lambda+Fx;
+  if (!R_FINITE(x) || (lambda > 0.0 && abs(x) > 1.0/lambda))
+    return 0.0;
+  return 1.0/dinvcdf_tlambda(Fx, lambda);
+}
+
 inline double rng_tlambda(double lambda, bool& throw_warning) {
   if (ISNAN(lambda)) {
     throw_warning = true;
@@ -47,6 +85,81 @@ inline double rng_tlambda(double lambda, bool& throw_warning) {
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_dtlambda(
+    const NumericVector& x,
+    const NumericVector& lambda,
+    const bool& log_prob = false
+  ) {
+  
+  int Nmax = std::max({
+    x.length(),
+    lambda.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  double Fx = NAN;
+  
+  for (int i = 0; i < Nmax; i++) {
+    // warm start at the previous cdf value if lambda is unchanged
+    if (i == 0 || GETV(lambda, i) != GETV(lambda, i-1) || !R_FINITE(Fx))
+      Fx = NAN;
+    Fx = cdf_tlambda(GETV(x, i), GETV(lambda, i), Fx,
+                     throw_warning);
+    p[i] = pdf_tlambda(GETV(x, i), GETV(lambda, i), Fx);
+  }
+  
+  if (log_prob)
+    p = Rcpp::log(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_ptlambda(
+    const NumericVector& x,
+    const NumericVector& lambda,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  int Nmax = std::max({
+    x.length(),
+    lambda.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  double start;
+  
+  for (int i = 0; i < Nmax; i++) {
+    // warm start at the previous cdf value if lambda is unchanged
+    if (i > 0 && GETV(lambda, i) == GETV(lambda, i-1))
+      start = p[i-1];
+    else
+      start = NAN;
+    p[i] = cdf_tlambda(GETV(x, i), GETV(lambda, i), start,
+                       throw_warning);
+  }
+  
+  if (!lower_tail)
+    p = 1.0 - p;
+  
+  if (log_prob)
+    p = Rcpp::log(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_qtlambda(
     const NumericVector& p,
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_kernels.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -51,9 +52,31 @@ inline double cdf_wald(double x, double mu, double lambda,
     return 0.0;
   if (x == R_PosInf)
     return 1.0;
-  return Phi(sqrt(lambda/x)*(x/mu-1.0)) +
-         exp((2.0*lambda)/mu) *
-         Phi(-sqrt(lambda/x)*(x/mu+1.0));
+  // exp(2*lambda/mu) overflows for lambda/mu above about 354, where
+  // the Phi term underflows, so their product is taken in log scale
+  double r = sqrt(lambda/x);
+  return Phi(r*(x/mu-1.0)) +
+         exp((2.0*lambda)/mu + R::pnorm(-r*(x/mu+1.0), 0.0, 1.0, true, true));
+}
+
+inline double invcdf_wald(double p, double mu, double lambda,
+                          double start, bool& throw_warning) {
+  if (ISNAN(p) || ISNAN(mu) || ISNAN(lambda))
+    return p+mu+lambda;
+  if (mu <= 0.0 || lambda <= 0.0 || !VALID_PROB(p)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (p == 0.0)
+    return 0.0;
+  if (p == 1.0)
+    return R_PosInf;
+  if (ISNAN(start))
+    start = mu;
+  return invcdf_numeric(p,
+    [&](double x) { return cdf_wald(x, mu, lambda, throw_warning); },
+    [&](double x) { return pdf_wald(x, mu, lambda, throw_warning); },
+    0.0, R_PosInf, start, throw_warning);
 }
 
 inline double rng_wald(double mu, double lambda, bool& throw_warning) {
@@ -73,6 +96,57 @@ inline double rng_wald(double mu, double lambda, bool& throw_warning) {
     return pow(mu, 2.0)/x;
 }
 
+// log F(x) or log(1-F(x)), exp(2*lambda/mu) is applied
+// in log scale so that it does not overflow
+
+inline double wald_lcdf(double x, double mu, double lambda, bool lower_tail) {
+  if (x <= 0.0)
+    return lower_tail ? R_NegInf : 0.0;
+  if (x == R_PosInf)
+    return lower_tail ? 0.0 : R_NegInf;
+  double r = sqrt(lambda/x);
+  double l2 = (2.0*lambda)/mu + R::pnorm(-r*(x/mu+1.0), 0.0, 1.0, true, true);
+  if (lower_tail)
+    return log_add_exp(R::pnorm(r*(x/mu-1.0), 0.0, 1.0, true, true), l2);
+  return log_sub_exp(R::pnorm(-r*(x/mu-1.0), 0.0, 1.0, true, true), l2);
+}
+
+// log P(lo < X <= hi); the difference is taken in the tail the
+// interval is in, and narrow intervals are integrated numerically
+
+double logint_wald(double lo, double hi, double mu, double lambda,
+                   bool& throw_warning) {
+  if (ISNAN(lo) || ISNAN(hi) || ISNAN(mu) || ISNAN(lambda))
+    return lo+hi+mu+lambda;
+  if (mu <= 0.0 || lambda <= 0.0 || lo > hi) {
+    throw_warning = true;
+    return NAN;
+  }
+  
+  lo = std::max(lo, 0.0);
+  if (hi <= lo)
+    return R_NegInf;
+  
+  // derivative of the log-density, bounds the change over the interval
+  auto dlogpdf = [&](double x) {
+    return abs(-1.5/x - lambda/(2.0*pow(mu, 2.0)) + lambda/(2.0*pow(x, 2.0)));
+  };
+  
+  if (lo > 0.0 && hi - lo < 0.05*lo &&
+      (hi - lo) * std::max(dlogpdf(lo), dlogpdf(hi)) < 0.05) {
+    return log_integrate_narrow(lo, hi, [&](double x) {
+      return 0.5*log(lambda/(2.0*PI*pow(x, 3.0))) -
+             lambda*pow(x-mu, 2.0)/(2.0*pow(mu, 2.0)*x);
+    });
+  }
+  
+  if (hi <= mu)
+    return log_sub_exp(wald_lcdf(hi, mu, lambda, true), wald_lcdf(lo, mu, lambda, true));
+  if (lo >= mu)
+    return log_sub_exp(wald_lcdf(lo, mu, lambda, false), wald_lcdf(hi, mu, lambda, false));
+  return log1p(-exp(wald_lcdf(lo, mu, lambda, true)) - exp(wald_lcdf(hi, mu, lambda, false)));
+}
+
 
 // [[Rcpp::export]]
 NumericVector cpp_dwald(
@@ -140,6 +214,51 @@ NumericVector cpp_pwald(
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_qwald(
+    const NumericVector& p,
+    const NumericVector& mu,
+    const NumericVector& lambda,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  int Nmax = std::max({
+    p.length(),
+    mu.length(),
+    lambda.length()
+  });
+  NumericVector x(Nmax);
+  NumericVector pp = Rcpp::clone(p);
+  
+  bool throw_warning = false;
+  double start;
+  
+  if (log_prob)
+    pp = Rcpp::exp(pp);
+  
+  if (!lower_tail)
+    pp = 1.0 - pp;
+  
+  for (int i = 0; i < Nmax; i++) {
+    // warm start at the previous quantile if parameters are unchanged
+    if (i > 0 && GETV(mu, i) == GETV(mu, i-1) &&
+        GETV(lambda, i) == GETV(lambda, i-1))
+      start = x[i-1];
+    else
+      start = NAN;
+    x[i] = invcdf_wald(GETV(pp, i), GETV(mu, i),
+                       GETV(lambda, i), start,
+                       throw_warning);
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return x;
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_rwald(
     const int& n,
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_families.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -24,8 +25,8 @@ using Rcpp::NumericVector;
 *
 */
 
-inline double pdf_zib(double x, double n, double p,
-                      double pi, bool& throw_warning) {
+double pdf_zib(double x, double n, double p,
+                      double pi, bool& throw_warning, bool int_x) {
   if (ISNAN(x) || ISNAN(n) || ISNAN(p) || ISNAN(pi))
     return x+n+p+pi;
   if (!VALID_PROB(p) || n < 0.0 || !VALID_PROB(pi) ||
@@ -33,7 +34,7 @@ inline double pdf_zib(double x, double n, double p,
     throw_warning = true;
     return NAN;
   }
-  if (x < 0.0 || !isInteger(x) || !R_FINITE(x))
+  if (x < 0.0 || (!int_x && !isInteger(x)) || !R_FINITE(x))
     return 0.0;
   if (x == 0.0)
     return pi + (1.0-pi) * pow(1.0-p, n);
@@ -41,7 +42,7 @@ inline double pdf_zib(double x, double n, double p,
     return (1.0-pi) * R::dbinom(x, n, p, false);
 }
 
-inline double cdf_zib(double x, double n, double p,
+double cdf_zib(double x, double n, double p,
                       double pi, bool& throw_warning) {
   if (ISNAN(x) || ISNAN(n) || ISNAN(p) || ISNAN(pi))
     return x+n+p+pi;
@@ -57,7 +58,7 @@ inline double cdf_zib(double x, double n, double p,
   return pi + (1.0-pi) * R::pbinom(x, n, p, true, false);
 }
 
-inline double invcdf_zib(double pp, double n, double p,
+double invcdf_zib(double pp, double n, double p,
                          double pi, bool& throw_warning) {
   if (ISNAN(pp) || ISNAN(n) || ISNAN(p) || ISNAN(pi))
     return pp+n+p+pi;
@@ -72,7 +73,7 @@ inline double invcdf_zib(double pp, double n, double p,
     return R::qbinom((pp - pi) / (1.0-pi), n, p, true, false);
 }
 
-inline double rng_zib(double n, double p, double pi,
+double rng_zib(double n, double p, double pi,
                       bool& throw_warning) {
   if (ISNAN(n) || ISNAN(p) || ISNAN(pi) || !VALID_PROB(p) ||
       n < 0.0 || !VALID_PROB(pi) || !isInteger(n, false)) {
@@ -87,13 +88,13 @@ inline double rng_zib(double n, double p, double pi,
 }
 
 
-// [[Rcpp::export]]
-NumericVector cpp_dzib(
-    const NumericVector& x,
+template <typename T>
+inline NumericVector dzib_values(
+    const T& x,
     const NumericVector& size,
     const NumericVector& prob,
     const NumericVector& pi,
-    const bool& log_prob = false
+    const bool& log_prob
   ) {
   
   int Nmax = std::max({
@@ -103,13 +104,14 @@ NumericVector cpp_dzib(
     pi.length()
   });
   NumericVector p(Nmax);
+  const bool int_values = std::is_same<T, Rcpp::IntegerVector>::value;
   
   bool throw_warning = false;
   
   for (int i = 0; i < Nmax; i++)
-    p[i] = pdf_zib(GETV(x, i), GETV(size, i),
+    p[i] = pdf_zib(as_dbl(GETV(x, i)), GETV(size, i),
                    GETV(prob, i), GETV(pi, i),
-                   throw_warning);
+                   throw_warning, int_values);
   
   if (log_prob)
     p = Rcpp::log(p);
@@ -122,15 +124,30 @@ NumericVector cpp_dzib(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_pzib(
-    const NumericVector& x,
+NumericVector cpp_dzib(
+    SEXP x,
     const NumericVector& size,
     const NumericVector& prob,
     const NumericVector& pi,
-    const bool& lower_tail = true,
     const bool& log_prob = false
   ) {
   
+  if (TYPEOF(x) == INTSXP)
+    return dzib_values(Rcpp::IntegerVector(x), size, prob, pi, log_prob);
+  return dzib_values(NumericVector(x), size, prob, pi, log_prob);
+}
+
+
+template <typename T>
+inline NumericVector pzib_values(
+    const T& x,
+    const NumericVector& size,
+    const NumericVector& prob,
+    const NumericVector& pi,
+    const bool& lower_tail,
+    const bool& log_prob
+  ) {
+  
   int Nmax = std::max({
     x.length(),
     size.length(),
@@ -142,7 +159,7 @@ NumericVector cpp_pzib(
   bool throw_warning = false;
   
   for (int i = 0; i < Nmax; i++)
-    p[i] = cdf_zib(GETV(x, i), GETV(size, i),
+    p[i] = cdf_zib(as_dbl(GETV(x, i)), GETV(size, i),
                    GETV(prob, i), GETV(pi, i),
                    throw_warning);
   
@@ -159,6 +176,23 @@ NumericVector cpp_pzib(
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_pzib(
+    SEXP x,
+    const NumericVector& size,
+    const NumericVector& prob,
+    const NumericVector& pi,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (TYPEOF(x) == INTSXP)
+    return pzib_values(Rcpp::IntegerVector(x), size, prob, pi, lower_tail,
+                       log_prob);
+  return pzib_values(NumericVector(x), size, prob, pi, lower_tail, log_prob);
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_qzib(
     const NumericVector& p,
@@ -199,24 +233,24 @@ NumericVector cpp_qzib(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_rzib(
+SEXP cpp_rzib(
     const int& n,
     const NumericVector& size,
     const NumericVector& prob,
     const NumericVector& pi
   ) {
   
-  NumericVector x(n);
+  int_values x(n);
   
   bool throw_warning = false;
   
   for (int i = 0; i < n; i++)
-    x[i] = rng_zib(GETV(size, i), GETV(prob, i),
-                   GETV(pi, i), throw_warning);
+    x.set(i, rng_zib(GETV(size, i), GETV(prob, i),
+                     GETV(pi, i), throw_warning));
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
   
-  return x;
+  return x.result();
 }
 
@@ -0,0 +1,178 @@
+#include <Rcpp.h>
+#include "shared.h"
+#include "shared_families.h"
+#include "shared_inflation.h"
+// [[Rcpp::plugins(cpp11)]]
+
+using std::pow;
+using std::sqrt;
+using std::abs;
+using std::exp;
+using std::log;
+using std::floor;
+using std::ceil;
+using Rcpp::NumericVector;
+
+
+/*
+ *  Zero-inflated and hurdle distributions from a given discrete family
+ *
+ *  Parameters:
+ *  list of vectors of parameters of the family
+ *  pi (probability of extra zeros, or of zero for hurdle distributions)
+ *
+ *  Zero-inflated:
+ *  f(0) = pi + (1-pi) * g(0)
+ *  f(x) = (1-pi) * g(x)                       for x > 0
+ *
+ *  Hurdle:
+ *  f(0) = pi
+ *  f(x) = (1-pi) * g(x) / (1 - G(0))          for x > 0
+ *
+ */
+
+
+template <typename F>
+inline void zi_check_family() {
+  if (!F::discrete)
+    Rcpp::stop("family of distributions should be discrete");
+}
+
+
+struct zi_pdf_op {
+  const NumericVector& x;
+  const std::vector<NumericVector>& params;
+  const NumericVector& pi;
+  bool hurdle, log_prob;
+  template <typename F> NumericVector run() const {
+    zi_check_family<F>();
+    return inflated_pdf<F>(x, params, pi, hurdle, log_prob);
+  }
+};
+
+struct zi_cdf_op {
+  const NumericVector& x;
+  const std::vector<NumericVector>& params;
+  const NumericVector& pi;
+  bool hurdle, lower_tail, log_prob;
+  template <typename F> NumericVector run() const {
+    zi_check_family<F>();
+    return inflated_cdf<F>(x, params, pi, hurdle, lower_tail, log_prob);
+  }
+};
+
+struct zi_invcdf_op {
+  const NumericVector& p;
+  const std::vector<NumericVector>& params;
+  const NumericVector& pi;
+  bool hurdle, lower_tail, log_prob;
+  template <typename F> NumericVector run() const {
+    zi_check_family<F>();
+    return inflated_invcdf<F>(p, params, pi, hurdle, lower_tail, log_prob);
+  }
+};
+
+struct zi_rng_op {
+  int n;
+  const std::vector<NumericVector>& params;
+  const NumericVector& pi;
+  bool hurdle;
+  template <typename F> NumericVector run() const {
+    zi_check_family<F>();
+    return inflated_rng<F>(n, params, pi, hurdle);
+  }
+};
+
+struct zi_loglik_op {
+  const NumericVector& x;
+  const std::vector<NumericVector>& params;
+  const NumericVector& pi;
+  bool hurdle;
+  template <typename F> NumericVector run() const {
+    zi_check_family<F>();
+    NumericVector out(1);
+    out[0] = inflated_loglik<F>(x, params, pi, hurdle);
+    return out;
+  }
+};
+
+
+// [[Rcpp::export]]
+NumericVector cpp_dzi(
+    const NumericVector& x,
+    const std::string& family,
+    const Rcpp::List& params,
+    const NumericVector& pi,
+    const bool& hurdle = false,
+    const bool& log_prob = false
+  ) {
+  
+  std::vector<NumericVector> par = param_list(params);
+  zi_pdf_op op = { x, par, pi, hurdle, log_prob };
+  return dispatch_family(family, op);
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_pzi(
+    const NumericVector& x,
+    const std::string& family,
+    const Rcpp::List& params,
+    const NumericVector& pi,
+    const bool& hurdle = false,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  std::vector<NumericVector> par = param_list(params);
+  zi_cdf_op op = { x, par, pi, hurdle, lower_tail, log_prob };
+  return dispatch_family(family, op);
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_qzi(
+    const NumericVector& p,
+    const std::string& family,
+    const Rcpp::List& params,
+    const NumericVector& pi,
+    const bool& hurdle = false,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  std::vector<NumericVector> par = param_list(params);
+  zi_invcdf_op op = { p, par, pi, hurdle, lower_tail, log_prob };
+  return dispatch_family(family, op);
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_rzi(
+    const int& n,
+    const std::string& family,
+    const Rcpp::List& params,
+    const NumericVector& pi,
+    const bool& hurdle = false
+  ) {
+  
+  std::vector<NumericVector> par = param_list(params);
+  zi_rng_op op = { n, par, pi, hurdle };
+  return dispatch_family(family, op);
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_llzi(
+    const NumericVector& x,
+    const std::string& family,
+    const Rcpp::List& params,
+    const NumericVector& pi,
+    const bool& hurdle = false
+  ) {
+  
+  std::vector<NumericVector> par = param_list(params);
+  zi_loglik_op op = { x, par, pi, hurdle };
+  return dispatch_family(family, op);
+}
+
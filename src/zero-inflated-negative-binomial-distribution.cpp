@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_families.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -24,15 +25,15 @@ using Rcpp::NumericVector;
 *
 */
 
-inline double pdf_zinb(double x, double r, double p, double pi,
-                       bool& throw_warning) {
+double pdf_zinb(double x, double r, double p, double pi,
+                       bool& throw_warning, bool int_x) {
   if (ISNAN(x) || ISNAN(r) || ISNAN(p) || ISNAN(pi))
     return x+r+p+pi;
   if (!VALID_PROB(p) || r < 0.0 || !VALID_PROB(pi) || !isInteger(r, false)) {
     throw_warning = true;
     return NAN;
   }
-  if (x < 0.0 || !isInteger(x) || !R_FINITE(x))
+  if (x < 0.0 || (!int_x && !isInteger(x)) || !R_FINITE(x))
     return 0.0;
   if (x == 0.0)
     return pi + (1.0-pi) * pow(p, r);
@@ -40,7 +41,7 @@ inline double pdf_zinb(double x, double r, double p, double pi,
     return (1.0-pi) * R::dnbinom(x, r, p, false);
 }
 
-inline double cdf_zinb(double x, double r, double p, double pi,
+double cdf_zinb(double x, double r, double p, double pi,
                        bool& throw_warning) {
   if (ISNAN(x) || ISNAN(r) || ISNAN(p) || ISNAN(pi))
     return x+r+p+pi;
@@ -55,7 +56,7 @@ inline double cdf_zinb(double x, double r, double p, double pi,
   return pi + (1.0-pi) * R::pnbinom(x, r, p, true, false);
 }
 
-inline double invcdf_zinb(double pp, double r, double p, double pi,
+double invcdf_zinb(double pp, double r, double p, double pi,
                           bool& throw_warning) {
   if (ISNAN(pp) || ISNAN(r) || ISNAN(p) || ISNAN(pi))
     return pp+r+p+pi;
@@ -70,7 +71,7 @@ inline double invcdf_zinb(double pp, double r, double p, double pi,
     return R::qnbinom((pp - pi) / (1.0-pi), r, p, true, false);
 }
 
-inline double rng_zinb(double r, double p, double pi,
+double rng_zinb(double r, double p, double pi,
                        bool& throw_warning) {
   if (ISNAN(r) || ISNAN(p) || ISNAN(pi) || !VALID_PROB(p) ||
       r < 0.0 || !VALID_PROB(pi) || !isInteger(r, false)) {
@@ -85,13 +86,13 @@ inline double rng_zinb(double r, double p, double pi,
 }
 
 
-// [[Rcpp::export]]
-NumericVector cpp_dzinb(
-    const NumericVector& x,
+template <typename T>
+inline NumericVector dzinb_values(
+    const T& x,
     const NumericVector& size,
     const NumericVector& prob,
     const NumericVector& pi,
-    const bool& log_prob = false
+    const bool& log_prob
   ) {
   
   int Nmax = std::max({
@@ -101,13 +102,14 @@ NumericVector cpp_dzinb(
     pi.length()
   });
   NumericVector p(Nmax);
+  const bool int_values = std::is_same<T, Rcpp::IntegerVector>::value;
   
   bool throw_warning = false;
   
   for (int i = 0; i < Nmax; i++)
-    p[i] = pdf_zinb(GETV(x, i), GETV(size, i),
+    p[i] = pdf_zinb(as_dbl(GETV(x, i)), GETV(size, i),
                     GETV(prob, i), GETV(pi, i),
-                    throw_warning);
+                    throw_warning, int_values);
   
   if (log_prob)
     p = Rcpp::log(p);
@@ -120,15 +122,30 @@ NumericVector cpp_dzinb(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_pzinb(
-    const NumericVector& x,
+NumericVector cpp_dzinb(
+    SEXP x,
     const NumericVector& size,
     const NumericVector& prob,
     const NumericVector& pi,
-    const bool& lower_tail = true,
     const bool& log_prob = false
   ) {
   
+  if (TYPEOF(x) == INTSXP)
+    return dzinb_values(Rcpp::IntegerVector(x), size, prob, pi, log_prob);
+  return dzinb_values(NumericVector(x), size, prob, pi, log_prob);
+}
+
+
+template <typename T>
+inline NumericVector pzinb_values(
+    const T& x,
+    const NumericVector& size,
+    const NumericVector& prob,
+    const NumericVector& pi,
+    const bool& lower_tail,
+    const bool& log_prob
+  ) {
+  
   int Nmax = std::max({
     x.length(),
     size.length(),
@@ -140,7 +157,7 @@ NumericVector cpp_pzinb(
   bool throw_warning = false;
   
   for (int i = 0; i < Nmax; i++)
-    p[i] = cdf_zinb(GETV(x, i), GETV(size, i),
+    p[i] = cdf_zinb(as_dbl(GETV(x, i)), GETV(size, i),
                     GETV(prob, i), GETV(pi, i),
                     throw_warning);
 
@@ -157,6 +174,23 @@ NumericVector cpp_pzinb(
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_pzinb(
+    SEXP x,
+    const NumericVector& size,
+    const NumericVector& prob,
+    const NumericVector& pi,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (TYPEOF(x) == INTSXP)
+    return pzinb_values(Rcpp::IntegerVector(x), size, prob, pi, lower_tail,
+                        log_prob);
+  return pzinb_values(NumericVector(x), size, prob, pi, lower_tail, log_prob);
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_qzinb(
     const NumericVector& p,
@@ -197,24 +231,24 @@ NumericVector cpp_qzinb(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_rzinb(
+SEXP cpp_rzinb(
     const int& n,
     const NumericVector& size,
     const NumericVector& prob,
     const NumericVector& pi
   ) {
   
-  NumericVector x(n);
+  int_values x(n);
   
   bool throw_warning = false;
   
   for (int i = 0; i < n; i++)
-    x[i] = rng_zinb(GETV(size, i), GETV(prob, i),
-                    GETV(pi, i), throw_warning);
+    x.set(i, rng_zinb(GETV(size, i), GETV(prob, i),
+                      GETV(pi, i), throw_warning));
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
   
-  return x;
+  return x.result();
 }
 
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include "shared_families.h"
 // [[Rcpp::plugins(cpp11)]]
 
 using std::pow;
@@ -24,15 +25,15 @@ using Rcpp::NumericVector;
 *
 */
 
-inline double pdf_zip(double x, double lambda, double pi,
-                      bool& throw_warning) {
+double pdf_zip(double x, double lambda, double pi,
+                      bool& throw_warning, bool int_x) {
   if (ISNAN(x) || ISNAN(lambda) || ISNAN(pi))
     return x+lambda+pi;
   if (lambda <= 0.0 || !VALID_PROB(pi)) {
     throw_warning = true;
     return NAN;
   }
-  if (x < 0.0 || !isInteger(x) || !R_FINITE(x))
+  if (x < 0.0 || (!int_x && !isInteger(x)) || !R_FINITE(x))
     return 0.0;
   if (x == 0.0)
     return pi + (1.0-pi) * exp(-lambda);
@@ -40,7 +41,7 @@ inline double pdf_zip(double x, double lambda, double pi,
     return (1.0-pi) * R::dpois(x, lambda, false);
 }
 
-inline double cdf_zip(double x, double lambda, double pi,
+double cdf_zip(double x, double lambda, double pi,
                       bool& throw_warning) {
   if (ISNAN(x) || ISNAN(lambda) || ISNAN(pi))
     return x+lambda+pi;
@@ -55,7 +56,7 @@ inline double cdf_zip(double x, double lambda, double pi,
   return pi + (1.0-pi) * R::ppois(x, lambda, true, false);
 }
 
-inline double invcdf_zip(double p, double lambda, double pi,
+double invcdf_zip(double p, double lambda, double pi,
                          bool& throw_warning) {
   if (ISNAN(p) || ISNAN(lambda) || ISNAN(pi))
     return p+lambda+pi;
@@ -69,7 +70,7 @@ inline double invcdf_zip(double p, double lambda, double pi,
     return R::qpois((p - pi) / (1.0-pi), lambda, true, false);
 }
 
-inline double rng_zip(double lambda, double pi, bool& throw_warning) {
+double rng_zip(double lambda, double pi, bool& throw_warning) {
   if (ISNAN(lambda) || ISNAN(pi) ||
       lambda <= 0.0 || !VALID_PROB(pi)) {
     throw_warning = true;
@@ -83,12 +84,12 @@ inline double rng_zip(double lambda, double pi, bool& throw_warning) {
 }
 
 
-// [[Rcpp::export]]
-NumericVector cpp_dzip(
-    const NumericVector& x,
+template <typename T>
+inline NumericVector dzip_values(
+    const T& x,
     const NumericVector& lambda,
     const NumericVector& pi,
-    const bool& log_prob = false
+    bool log_prob
   ) {
   
   int Nmax = std::max({
@@ -97,12 +98,13 @@ NumericVector cpp_dzip(
     pi.length()
   });
   NumericVector p(Nmax);
+  const bool int_values = std::is_same<T, Rcpp::IntegerVector>::value;
   
   bool throw_warning = false;
   
   for (int i = 0; i < Nmax; i++)
-    p[i] = pdf_zip(GETV(x, i), GETV(lambda, i),
-                   GETV(pi, i), throw_warning);
+    p[i] = pdf_zip(as_dbl(GETV(x, i)), GETV(lambda, i),
+                   GETV(pi, i), throw_warning, int_values);
   
   if (log_prob)
     p = Rcpp::log(p);
@@ -115,14 +117,27 @@ NumericVector cpp_dzip(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_pzip(
-    const NumericVector& x,
+NumericVector cpp_dzip(
+    SEXP x,
     const NumericVector& lambda,
     const NumericVector& pi,
-    const bool& lower_tail = true,
     const bool& log_prob = false
   ) {
   
+  if (TYPEOF(x) == INTSXP)
+    return dzip_values(Rcpp::IntegerVector(x), lambda, pi, log_prob);
+  return dzip_values(NumericVector(x), lambda, pi, log_prob);
+}
+
+
+template <typename T>
+inline NumericVector pzip_values(
+    const T& x,
+    const NumericVector& lambda,
+    const NumericVector& pi,
+    bool lower_tail, bool log_prob
+  ) {
+  
   int Nmax = std::max({
     x.length(),
     lambda.length(),
@@ -133,7 +148,7 @@ NumericVector cpp_pzip(
   bool throw_warning = false;
   
   for (int i = 0; i < Nmax; i++)
-    p[i] = cdf_zip(GETV(x, i), GETV(lambda, i),
+    p[i] = cdf_zip(as_dbl(GETV(x, i)), GETV(lambda, i),
                    GETV(pi, i), throw_warning);
   
   if (!lower_tail)
@@ -149,6 +164,22 @@ NumericVector cpp_pzip(
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_pzip(
+    SEXP x,
+    const NumericVector& lambda,
+    const NumericVector& pi,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (TYPEOF(x) == INTSXP)
+    return pzip_values(Rcpp::IntegerVector(x), lambda, pi, lower_tail,
+                       log_prob);
+  return pzip_values(NumericVector(x), lambda, pi, lower_tail, log_prob);
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_qzip(
     const NumericVector& p,
@@ -186,23 +217,23 @@ NumericVector cpp_qzip(
 
 
 // [[Rcpp::export]]
-NumericVector cpp_rzip(
+SEXP cpp_rzip(
     const int& n,
     const NumericVector& lambda,
     const NumericVector& pi
   ) {
   
-  NumericVector x(n);
+  int_values x(n);
   
   bool throw_warning = false;
   
   for (int i = 0; i < n; i++)
-    x[i] = rng_zip(GETV(lambda, i), GETV(pi, i),
-                   throw_warning);
+    x.set(i, rng_zip(GETV(lambda, i), GETV(pi, i),
+                     throw_warning));
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
   
-  return x;
+  return x.result();
 }
 